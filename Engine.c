@@ -0,0 +1,549 @@
+/*
+Nintendo Switch Fightstick - Proof-of-Concept
+
+Based on the LUFA library's Low-Level Joystick Demo
+	(C) Dean Camera
+Based on the HORI's Pokken Tournament Pro Pad design
+	(C) HORI
+
+This project implements a modified version of HORI's Pokken Tournament Pro Pad
+USB descriptors to allow for the creation of custom controllers for the
+Nintendo Switch. This also works to a limited degree on the PS3.
+
+Since System Update v3.0.0, the Nintendo Switch recognizes the Pokken
+Tournament Pro Pad as a Pro Controller. Physical design limitations prevent
+the Pokken Controller from functioning at the same level as the Pro
+Controller. However, by default most of the descriptors are there, with the
+exception of Home and Capture. Descriptor modification allows us to unlock
+these buttons for our use.
+*/
+
+/** \file
+ *
+ *  Macro engine shared by every script. This file contains the main tasks of
+ *  the firmware and is responsible for the initial application hardware
+ *  configuration; it interprets the flash-resident program of the script it is
+ *  linked with.
+ */
+
+#include "Engine.h"
+#ifdef SCRIPT_UPLOAD
+#include "Upload.h"
+#endif
+
+// Main entry point.
+int main(void) {
+	// We'll start by performing hardware and peripheral setup.
+	SetupHardware();
+	// We'll then enable global interrupts for our use.
+	GlobalInterruptEnable();
+	// Once that's done, we'll enter an infinite loop.
+	for (;;)
+	{
+		#ifdef PROFILE
+		// The profiling build only builds reports, see ProfileTask().
+		ProfileTask();
+		#else
+		// We need to run our task to process and deliver data for our IN and OUT endpoints.
+		HID_Task();
+		// We also need to run the main USB management task.
+		USB_USBTask();
+		// We build the next report ahead of the host asking for it, so that
+		// answering the host is only a copy. Other tasks may run here too, as
+		// long as they return well within a poll interval.
+		PrepareReport();
+		#ifdef SCRIPT_UPLOAD
+		// Scripts uploaded over the UART, see Upload.c.
+		UploadTask();
+		#endif
+		#endif
+	}
+}
+
+// Configures hardware and peripherals, such as the USB peripherals.
+void SetupHardware(void) {
+	// We need to disable watchdog if enabled by bootloader/fuses.
+	MCUSR &= ~(1 << WDRF);
+	wdt_disable();
+
+	// We need to disable clock division before initializing the USB hardware.
+	clock_prescale_set(clock_div_1);
+	// We can then initialize our hardware and peripherals, including the USB stack.
+
+	#ifdef ALERT_WHEN_DONE
+	// Both PORTD and PORTB will be used for the optional LED flashing and buzzer.
+	#warning LED and Buzzer functionality enabled. All pins on both PORTB and \
+PORTD will toggle when printing is done.
+	DDRD  = 0xFF; //Teensy uses PORTD
+	PORTD =  0x0;
+                  //We'll just flash all pins on both ports since the UNO R3
+	DDRB  = 0xFF; //uses PORTB. Micro can use either or, but both give us 2 LEDs
+	PORTB =  0x0; //The ATmega328P on the UNO will be resetting, so unplug it?
+	#endif
+	// Timer 0 ticks the millisecond clock: CTC mode, clk/64, 1 kHz compare match.
+	TCCR0A = (1 << WGM01);
+	TCCR0B = (1 << CS01) | (1 << CS00);
+	OCR0A  = F_CPU / 64 / 1000 - 1;
+	TIMSK0 = (1 << OCIE0A);
+	// The USB stack should be initialized last.
+	#ifndef PROFILE
+	USB_Init();
+	#endif
+}
+
+// Fired to indicate that the device is enumerating.
+void EVENT_USB_Device_Connect(void) {
+	// We can indicate that we're enumerating here (via status LEDs, sound, etc.).
+}
+
+// Fired to indicate that the device is no longer connected to a host.
+void EVENT_USB_Device_Disconnect(void) {
+	// We can indicate that our device is not ready (via status LEDs, sound, etc.).
+	// Whatever the script was doing is lost on the console: once plugged back
+	// in, it has to sync again, so it starts over.
+	RestartProgram();
+}
+
+// Fired when the host set the current configuration of the USB device after enumeration.
+void EVENT_USB_Device_ConfigurationChanged(void) {
+	bool ConfigSuccess = true;
+
+	// We setup the HID report endpoints.
+	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_OUT_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
+	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_IN_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
+
+	// We can read ConfigSuccess to indicate a success or failure at this point.
+}
+
+// Process control requests sent to the device from the USB host.
+void EVENT_USB_Device_ControlRequest(void) {
+	// We can handle two control requests: a GetReport and a SetReport.
+
+	// Not used here, it looks like we don't receive control request from the Switch.
+}
+
+// Process and deliver data from IN and OUT endpoints.
+void HID_Task(void) {
+	// If the device isn't connected and properly configured, we can't do anything here.
+	if (USB_DeviceState != DEVICE_STATE_Configured)
+		return;
+
+	// We'll start with the OUT endpoint.
+	Endpoint_SelectEndpoint(JOYSTICK_OUT_EPADDR);
+	// We'll check to see if we received something on the OUT endpoint.
+	if (Endpoint_IsOUTReceived())
+	{
+		// We're not doing anything with this data, so we don't even read it:
+		// acknowledging the OUT packet discards it.
+		Endpoint_ClearOUT();
+	}
+
+	// We'll then move on to the IN endpoint.
+	Endpoint_SelectEndpoint(JOYSTICK_IN_EPADDR);
+	// We first check to see if the host is ready to accept data.
+	if (Endpoint_IsINReady())
+	{
+		// The report is ready, and the bank has room for all of it, so writing
+		// it never waits.
+		Endpoint_Write_Stream_LE(GetNextReport(), sizeof(USB_JoystickReport_Input_t), NULL);
+		// We then send an IN packet on this endpoint.
+		Endpoint_ClearIN();
+	}
+}
+
+volatile uint32_t Milliseconds = 0;
+
+// Counts the milliseconds.
+ISR(TIMER0_COMPA_vect) {
+	Milliseconds++;
+}
+
+uint32_t Millis(void) {
+	uint32_t now;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		now = Milliseconds;
+	}
+	return now;
+}
+
+// When the current step ends, in Milliseconds. Each step's deadline follows
+// from the previous one rather than from the poll that loaded it, so late
+// polls don't add up. The schedule starts with the first report.
+static uint32_t deadline = 0;
+static bool scheduled = false;
+
+// Reports go out of a double buffer: Reports[current] is the one the host
+// gets, and Reports[current ^ 1] the next one, built ahead of time with its
+// length in Milliseconds.
+static USB_JoystickReport_Input_t Reports[2];
+static uint8_t current = 0;
+static bool next_ready = false;
+static uint32_t next_length;
+#ifdef MARK_HOOK
+// The last MARK run while building the next report, passed on to MARK_HOOK
+// when that report goes out.
+static uint8_t next_mark = 0;
+#endif
+
+// Sync the controller. MUST HAVE!
+const Step_t SyncController[] PROGMEM = {
+  WAIT(75),
+  STEP_BUTTONS(SWITCH_L | SWITCH_R, POS_CENTER, BUTTON_DURATION),
+  WAIT(75),
+  STEP_BUTTONS(SWITCH_L | SWITCH_R, POS_CENTER, BUTTON_DURATION),
+  WAIT(75),
+  PRESS(SWITCH_A),
+  WAIT(75),
+  PRESS(SWITCH_A),
+  RET
+};
+
+// Scripts without natives link with this empty table instead.
+const Native_t Natives[] __attribute__((weak)) PROGMEM = {
+  NULL
+};
+
+// Where the interpreter stops on END, or on a malformed program.
+static const Step_t Halt[] PROGMEM = {
+  END
+};
+
+// Length of each control instruction, opcode byte included.
+static const uint8_t OpLengths[16] PROGMEM = {
+  [OP_END] = 1, [OP_CALL] = 2, [OP_RET] = 1, [OP_LOOP] = 3,
+  [OP_LOOP_REG] = 2, [OP_FOREVER] = 1, [OP_NEXT] = 1, [OP_SET] = 4,
+  [OP_ADD] = 4, [OP_SKIP_EQ] = 4, [OP_SKIP_NE] = 4, [OP_JUMP] = 3,
+  [OP_MARK] = 2, [OP_NATIVE] = 2,
+};
+
+// A call or loop in progress: where to return to or loop back to, and for
+// loops the iterations left, 0 meaning forever.
+typedef struct {
+  const Step_t* pc;
+  uint16_t count;
+} Frame_t;
+
+static const Step_t* pc;
+static Frame_t stack[VM_STACK_DEPTH];
+static uint8_t sp = 0;
+static uint16_t Registers[VM_REGISTERS];
+// Whether the native the program is on has been called already.
+static bool native_running = false;
+// Set by RestartProgram(), for PrepareReport() to act on.
+static volatile bool restart = false;
+
+// Stick values of the STEP_POS grid.
+static const uint8_t StickLevels[3] = {STICK_MIN, STICK_CENTER, STICK_MAX};
+
+// Returns the length of the instruction at `at`.
+static uint8_t InstructionLength(const Step_t* at) {
+  uint8_t head = pgm_read_byte(at);
+
+  if ((head & 0x0F) == STEP_OP)
+    return pgm_read_byte(&OpLengths[head >> 4]);
+  return 2 + ((head >> 4) == STEP_RAW ? 2 : 0) + ((head & 0x0F) == STEP_RAW ? 2 : 0);
+}
+
+// Decodes the step at `at` into the report, and returns the next instruction.
+// Its duration goes to `ticks`.
+static const Step_t* LoadStep(USB_JoystickReport_Input_t* const ReportData, const Step_t* at, uint16_t* ticks) {
+  uint8_t head = pgm_read_byte(at++);
+  uint8_t button = head >> 4;
+  uint8_t pos = head & 0x0F;
+  uint8_t duration;
+
+  if (button == STEP_RAW) {
+    ReportData->Button |= pgm_read_word(at);
+    at += 2;
+  } else if (button) {
+    ReportData->Button |= 1 << (button - 1);
+  }
+  if (pos == STEP_RAW) {
+    ReportData->LX = pgm_read_byte(at++);
+    ReportData->LY = pgm_read_byte(at++);
+  } else {
+    ReportData->LX = StickLevels[pos % 3];
+    ReportData->LY = StickLevels[pos / 3];
+  }
+  duration = pgm_read_byte(at++);
+  *ticks = duration < 128 ? duration : 128 + ((duration - 128) << 2);
+  return at;
+}
+
+// Returns the instruction after the NEXT closing the loop whose body starts
+// at `at`.
+static const Step_t* SkipLoop(const Step_t* at) {
+  uint8_t depth = 0;
+
+  for (;;) {
+    uint8_t head = pgm_read_byte(at);
+    if ((head & 0x0F) == STEP_OP) {
+      uint8_t op = head >> 4;
+      if (op == OP_LOOP || op == OP_LOOP_REG || op == OP_FOREVER)
+        depth++;
+      else if (op == OP_NEXT && depth-- == 0)
+        return at + 1;
+      else if (op == OP_END)
+        return at;
+    }
+    at += InstructionLength(at);
+  }
+}
+
+// Opens a loop of `count` iterations whose body starts at `pc`.
+static void PushLoop(uint16_t count, bool forever) {
+  if (!forever && count == 0) {
+    pc = SkipLoop(pc);
+  } else if (sp == VM_STACK_DEPTH) {
+    pc = Halt;
+  } else {
+    stack[sp].pc = pc;
+    stack[sp].count = forever ? 0 : count;
+    sp++;
+  }
+}
+
+// Routine `routine`: the uploaded script's, if there's one, or the table's.
+static const Step_t* Routine(uint8_t routine) {
+  #ifdef SCRIPT_UPLOAD
+  const Step_t* uploaded = UploadedRoutine(routine);
+
+  if (uploaded != NULL)
+    return uploaded;
+  #endif
+  return pgm_read_ptr(&Routines[routine]);
+}
+
+// Runs the program until a step has been loaded into the report, or until
+// VM_MAX_OPS control operations have run. END leaves the report neutral.
+// Returns the duration of the step loaded, 0 if none.
+static uint16_t RunProgram(USB_JoystickReport_Input_t* const ReportData) {
+  uint8_t ops;
+  uint16_t ticks = 0;
+
+  if (pc == NULL)
+    pc = Routine(0);
+
+  for (ops = 0; ops < VM_MAX_OPS; ops++) {
+    uint8_t head = pgm_read_byte(pc);
+    uint8_t op = head >> 4;
+    uint8_t length = pgm_read_byte(&OpLengths[op]);
+    uint8_t reg = 0;
+    uint16_t value = 0;
+
+    if ((head & 0x0F) != STEP_OP) {
+      pc = LoadStep(ReportData, pc, &ticks);
+      return ticks;
+    }
+
+    // Fetch the operands: a routine or register and a 16-bit value, or a
+    // lone 16-bit count
+    if (length == 3) {
+      value = pgm_read_word(pc + 1);
+    } else if (length >= 2) {
+      reg = pgm_read_byte(pc + 1);
+      if (length == 4)
+        value = pgm_read_word(pc + 2);
+    }
+    pc += length;
+
+    switch (op) {
+      case OP_END:
+        pc = Halt;
+        return 0;
+      case OP_CALL:
+        if (sp == VM_STACK_DEPTH) {
+          pc = Halt;
+          return 0;
+        }
+        stack[sp].pc = pc;
+        sp++;
+        pc = Routine(reg);
+        break;
+      case OP_RET:
+        if (sp == 0) {
+          pc = Halt;
+          return 0;
+        }
+        pc = stack[--sp].pc;
+        break;
+      case OP_LOOP:
+        PushLoop(value, false);
+        break;
+      case OP_LOOP_REG:
+        PushLoop(Registers[reg % VM_REGISTERS], false);
+        break;
+      case OP_FOREVER:
+        PushLoop(0, true);
+        break;
+      case OP_NEXT:
+        if (sp == 0) {
+          pc = Halt;
+          return 0;
+        }
+        if (stack[sp - 1].count == 0 || --stack[sp - 1].count > 0)
+          pc = stack[sp - 1].pc;
+        else
+          sp--;
+        break;
+      case OP_SET:
+        Registers[reg % VM_REGISTERS] = value;
+        break;
+      case OP_ADD:
+        Registers[reg % VM_REGISTERS] += value;
+        break;
+      case OP_SKIP_EQ:
+        if (Registers[reg % VM_REGISTERS] == value)
+          pc += InstructionLength(pc);
+        break;
+      case OP_SKIP_NE:
+        if (Registers[reg % VM_REGISTERS] != value)
+          pc += InstructionLength(pc);
+        break;
+      case OP_JUMP:
+        pc += (int16_t)value;
+        break;
+      case OP_MARK:
+#ifdef MARK_HOOK
+        next_mark = reg;
+#endif
+        break;
+      case OP_NATIVE: {
+        Native_t native = (Native_t)pgm_read_ptr(&Natives[reg]);
+        if (native == NULL) {
+          pc = Halt;
+          return 0;
+        }
+        ticks = native(ReportData, !native_running);
+        if (ticks == NATIVE_DONE) {
+          native_running = false;
+          break;
+        }
+        // Back on the NATIVE instruction for the next report
+        native_running = true;
+        pc -= length;
+        return ticks;
+      }
+      default:
+        pc = Halt;
+        return 0;
+    }
+  }
+  return 0;
+}
+
+// Start the program over, from the next report on.
+void RestartProgram(void) {
+	restart = true;
+}
+
+// Marks the report being built.
+void SetMark(uint8_t id) {
+	#ifdef MARK_HOOK
+	next_mark = id;
+	#endif
+}
+
+// Build the next report, unless it's built already.
+void PrepareReport(void) {
+	USB_JoystickReport_Input_t* const ReportData = &Reports[current ^ 1];
+
+	if (restart)
+	{
+		// Drop the report built and the schedule, and run from the top
+		restart = false;
+		pc = NULL;
+		sp = 0;
+		memset(Registers, 0, sizeof(Registers));
+		native_running = false;
+		next_ready = false;
+		scheduled = false;
+		#ifdef MARK_HOOK
+		next_mark = 0;
+		#endif
+	}
+	if (next_ready)
+		return;
+
+	// Prepare an empty report
+	memset(ReportData, 0, sizeof(USB_JoystickReport_Input_t));
+	ReportData->LX = STICK_CENTER;
+	ReportData->LY = STICK_CENTER;
+	ReportData->RX = STICK_CENTER;
+	ReportData->RY = STICK_CENTER;
+	ReportData->HAT = HAT_CENTER;
+
+	// Run the script up to its next step
+	next_length = (uint32_t)RunProgram(ReportData) * ENGINE_TICK_MS;
+	next_ready = true;
+}
+
+// Get the report for the host's current poll.
+const USB_JoystickReport_Input_t* GetNextReport(void) {
+	uint32_t now = Millis();
+
+	// A restart drops the schedule, so it's done before the schedule is read,
+	// lest the first step it builds go out on the old one
+	if (restart)
+		PrepareReport();
+	if (!scheduled)
+	{
+		deadline = now;
+		scheduled = true;
+	}
+
+	// Repeat the current report until its step is over, then move on to the
+	// next one, normally built already, and schedule its end. If the host
+	// stopped polling for longer than the whole step, restart the schedule
+	// from now rather than drop the step.
+	if ((int32_t)(now - deadline) >= 0)
+	{
+		PrepareReport();
+		current ^= 1;
+		next_ready = false;
+		#ifdef MARK_HOOK
+		if (next_mark)
+		{
+			MARK_HOOK(next_mark);
+			next_mark = 0;
+		}
+		#endif
+		deadline += next_length;
+		if ((int32_t)(now - deadline) > 0)
+			deadline = now + next_length;
+	}
+	#ifdef REPORT_HOOK
+	REPORT_HOOK(&Reports[current]);
+	#endif
+	return &Reports[current];
+}
+
+#ifdef PROFILE
+// Takes a report every PROFILE_POLL_MS, as if polled by the host, and builds
+// the next ones, with GPIOR0 set to 1 while answering the poll and to 2 while
+// building a report, so that bench/profile.c can time both.
+void ProfileTask(void) {
+	static uint32_t NextPoll = 0;
+
+	if ((int32_t)(Millis() - NextPoll) >= 0)
+	{
+		NextPoll += PROFILE_POLL_MS;
+		GPIOR0 = 1;
+		GetNextReport();
+		GPIOR0 = 0;
+	}
+	if (!next_ready)
+	{
+		GPIOR0 = 2;
+		PrepareReport();
+		GPIOR0 = 0;
+	}
+}
+
+// Shows the current mark in GPIOR1, so that bench/profile.c can tell the
+// script's phases apart.
+void ProfileMark(uint8_t id) {
+	GPIOR1 = id;
+}
+#endif
@@ -0,0 +1,308 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2014.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2014  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Header file for Engine.c, the macro engine shared by every script. It holds
+ *  the HID report types and the bytecode API; the scripts only provide their
+ *  Routines table.
+ */
+
+#ifndef _ENGINE_H_
+#define _ENGINE_H_
+
+/* Includes: */
+#include <avr/io.h>
+#include <avr/wdt.h>
+#include <avr/power.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <util/atomic.h>
+#include <string.h>
+
+#include <LUFA/Drivers/USB/USB.h>
+#include <LUFA/Drivers/Board/Joystick.h>
+#include <LUFA/Drivers/Board/LEDs.h>
+#include <LUFA/Drivers/Board/Buttons.h>
+#include <LUFA/Platform/Platform.h>
+
+#include "Descriptors.h"
+
+// Type Defines
+// Enumeration for joystick buttons.
+typedef enum {
+	SWITCH_Y       = 0x01,
+	SWITCH_B       = 0x02,
+	SWITCH_A       = 0x04,
+	SWITCH_X       = 0x08,
+	SWITCH_L       = 0x10,
+	SWITCH_R       = 0x20,
+	SWITCH_ZL      = 0x40,
+	SWITCH_ZR      = 0x80,
+	SWITCH_MINUS   = 0x100,
+	SWITCH_PLUS    = 0x200,
+	SWITCH_LCLICK  = 0x400,
+	SWITCH_RCLICK  = 0x800,
+	SWITCH_HOME    = 0x1000,
+	SWITCH_CAPTURE = 0x2000,
+} JoystickButtons_t;
+
+#define HAT_TOP          0x00
+#define HAT_TOP_RIGHT    0x01
+#define HAT_RIGHT        0x02
+#define HAT_BOTTOM_RIGHT 0x03
+#define HAT_BOTTOM       0x04
+#define HAT_BOTTOM_LEFT  0x05
+#define HAT_LEFT         0x06
+#define HAT_TOP_LEFT     0x07
+#define HAT_CENTER       0x08
+
+#define STICK_MIN      0
+#define STICK_CENTER 128
+#define STICK_MAX    255
+
+// Joystick HID report structure. We have an input and an output.
+typedef struct {
+	uint16_t Button; // 16 buttons; see JoystickButtons_t for bit mapping
+	uint8_t  HAT;    // HAT switch; one nibble w/ unused nibble
+	uint8_t  LX;     // Left  Stick X
+	uint8_t  LY;     // Left  Stick Y
+	uint8_t  RX;     // Right Stick X
+	uint8_t  RY;     // Right Stick Y
+	uint8_t  VendorSpec;
+} USB_JoystickReport_Input_t;
+
+// The output is structured as a mirror of the input.
+// This is based on initial observations of the Pokken Controller.
+typedef struct {
+	uint16_t Button; // 16 buttons; see JoystickButtons_t for bit mapping
+	uint8_t  HAT;    // HAT switch; one nibble w/ unused nibble
+	uint8_t  LX;     // Left  Stick X
+	uint8_t  LY;     // Left  Stick Y
+	uint8_t  RX;     // Right Stick X
+	uint8_t  RY;     // Right Stick Y
+} USB_JoystickReport_Output_t;
+
+// Scripts are programs for a small bytecode interpreter, stored in flash
+// (PROGMEM) and read with pgm_read_*. Most instructions are steps, which say
+// which buttons should be pressed, and where the left stick should be, for
+// how many ticks of ENGINE_TICK_MS:
+//
+//   byte 0          high nibble: button code, 0 for none, n for the single
+//                   button of bit n - 1, STEP_RAW if the 16-bit button mask
+//                   follows (low byte first).
+//                   low nibble: stick position, STEP_POS(lx, ly) on the 3x3
+//                   grid of STICK_MIN/STICK_CENTER/STICK_MAX, or STEP_RAW if
+//                   the LX and LY bytes follow.
+//   [2 bytes]       button mask, if the button code is STEP_RAW.
+//   [2 bytes]       LX, LY, if the stick position is STEP_RAW.
+//   last byte       duration class: 0-127 as is, above that 128 plus four
+//                   times the excess, i.e. up to 636.
+//
+// A typical step is therefore 2 bytes. A low nibble of STEP_OP makes the
+// instruction a control operation instead, with the opcode in the high nibble
+// and its operands in the following bytes (16-bit operands low byte first).
+typedef uint8_t Step_t;
+
+#define STEP_RAW 0x0F
+#define STEP_OP  0x09
+
+// Length of a duration tick in milliseconds. Steps are timed against the
+// millisecond clock rather than counted in polls, so the host's poll rate and
+// missed polls no longer change how long a step lasts. 8 ms approximates the
+// interval at which the Switch polls the controller, so the existing scripts
+// keep their pacing.
+#ifndef ENGINE_TICK_MS
+#define ENGINE_TICK_MS 8
+#endif
+
+// Stick positions on the 3x3 grid, 0 for STICK_MIN, 1 for STICK_CENTER and 2
+// for STICK_MAX.
+#define STEP_POS(lx, ly)    ((ly) * 3 + (lx))
+#define POS_UP_LEFT         STEP_POS(0, 0)
+#define POS_UP              STEP_POS(1, 0)
+#define POS_UP_RIGHT        STEP_POS(2, 0)
+#define POS_LEFT            STEP_POS(0, 1)
+#define POS_CENTER          STEP_POS(1, 1)
+#define POS_RIGHT           STEP_POS(2, 1)
+#define POS_DOWN_LEFT       STEP_POS(0, 2)
+#define POS_DOWN            STEP_POS(1, 2)
+#define POS_DOWN_RIGHT      STEP_POS(2, 2)
+
+// Durations above 127 are rounded down to a multiple of 4.
+#define STEP_DURATION(d)    ((d) < 128 ? (d) : 128 + (((d) - 128) >> 2))
+#define BUTTON_CODE(button) ((button) ? __builtin_ctz(button) + 1 : 0)
+
+// A step holding a single button (or 0) with the stick at a grid position.
+#define STEP(button, pos, d) \
+  (BUTTON_CODE(button) << 4) | (pos), STEP_DURATION(d)
+// A step holding several buttons at once.
+#define STEP_BUTTONS(buttons, pos, d) \
+  (STEP_RAW << 4) | (pos), (buttons) & 0xFF, (buttons) >> 8, STEP_DURATION(d)
+// A step holding the stick off the grid.
+#define STEP_STICK(button, lx, ly, d) \
+  (BUTTON_CODE(button) << 4) | STEP_RAW, (lx), (ly), STEP_DURATION(d)
+
+#define WAIT(d)       STEP(0, POS_CENTER, d)
+#define MOVE(pos, d)  STEP(0, pos, d)
+#define PRESS(button) STEP(button, POS_CENTER, BUTTON_DURATION)
+
+// Control opcodes.
+typedef enum {
+	OP_END,      // Stops the script; neutral reports from then on.
+	OP_CALL,     // CALL(routine): runs Routines[routine] until its RET.
+	OP_RET,      // Returns from a CALL.
+	OP_LOOP,     // LOOP(n) ... NEXT: runs the body n times (zero allowed).
+	OP_LOOP_REG, // LOOP_REG(reg) ... NEXT: runs the body Registers[reg] times.
+	OP_FOREVER,  // FOREVER ... NEXT: runs the body until the end of time.
+	OP_NEXT,     // Closes a loop.
+	OP_SET,      // SET_REG(reg, v): Registers[reg] = v.
+	OP_ADD,      // ADD_REG(reg, v): Registers[reg] += v.
+	OP_SKIP_EQ,  // SKIP_IF_EQ(reg, v): skips the next instruction if equal.
+	OP_SKIP_NE,  // SKIP_IF_NE(reg, v): skips the next instruction if not.
+	OP_JUMP,     // JUMP(offset): jumps within the routine, relative to the
+	             // next instruction. Must not enter or leave a loop.
+	OP_MARK,     // MARK(id): marks the start of a phase of the script, for
+	             // tools following it; mark 1 starts a cycle by convention.
+	OP_NATIVE,   // NATIVE(native): runs Natives[native] until it's done.
+} Opcode_t;
+
+#define OP(op)               (((op) << 4) | STEP_OP)
+#define END                  OP(OP_END)
+#define CALL(routine)        OP(OP_CALL), (routine)
+#define RET                  OP(OP_RET)
+#define LOOP(n)              OP(OP_LOOP), (n) & 0xFF, (n) >> 8
+#define LOOP_REG(reg)        OP(OP_LOOP_REG), (reg)
+#define FOREVER              OP(OP_FOREVER)
+#define NEXT                 OP(OP_NEXT)
+#define SET_REG(reg, v)      OP(OP_SET), (reg), (v) & 0xFF, ((v) >> 8) & 0xFF
+#define ADD_REG(reg, v)      OP(OP_ADD), (reg), (v) & 0xFF, ((v) >> 8) & 0xFF
+#define SKIP_IF_EQ(reg, v)   OP(OP_SKIP_EQ), (reg), (v) & 0xFF, ((v) >> 8) & 0xFF
+#define SKIP_IF_NE(reg, v)   OP(OP_SKIP_NE), (reg), (v) & 0xFF, ((v) >> 8) & 0xFF
+#define JUMP(offset)         OP(OP_JUMP), (offset) & 0xFF, ((offset) >> 8) & 0xFF
+#define MARK(id)             OP(OP_MARK), (id)
+#define NATIVE(native)       OP(OP_NATIVE), (native)
+
+// Registers, all starting at 0.
+#define VM_REGISTERS 4
+#define R0 0
+#define R1 1
+#define R2 2
+#define R3 3
+
+// Nesting depth of calls and loops together.
+#define VM_STACK_DEPTH 8
+// MARK_HOOK names a function called with the id of a MARK when the first
+// report after it goes out (the last one, if several come before a step),
+// defined by builds that watch the script, such as the host build. MARK does
+// nothing otherwise.
+#if defined(PROFILE) && !defined(MARK_HOOK)
+#define MARK_HOOK ProfileMark
+#endif
+#ifdef MARK_HOOK
+void MARK_HOOK(uint8_t id);
+#endif
+// REPORT_HOOK names a function called with the report about to go out on
+// every poll, which it may change, defined by builds that must get input
+// into the very next report, such as the stream firmware's live mode.
+#ifdef REPORT_HOOK
+void REPORT_HOOK(USB_JoystickReport_Input_t* const ReportData);
+#endif
+
+// Control operations run per report at most, so that a report never takes
+// long to build; a longer run of them yields a neutral report for a poll, so
+// mac2c.py rejects programs that may run more between two steps.
+#define VM_MAX_OPS 16
+
+// Common steps.
+#define BUTTON_DURATION 10
+#define BUTTON_A     PRESS(SWITCH_A)
+#define BUTTON_B     PRESS(SWITCH_B)
+#define BUTTON_X     PRESS(SWITCH_X)
+#define BUTTON_R     PRESS(SWITCH_R)
+#define BUTTON_GAP   WAIT(50)
+#define BUTTON_RIGHT MOVE(POS_RIGHT, 25)
+#define BUTTON_LEFT  MOVE(POS_LEFT, 25)
+#define BUTTON_DOWN  MOVE(POS_DOWN, 25)
+#define BUTTON_UP    MOVE(POS_UP, 25)
+
+// Milliseconds since power-up, counted by Timer 0. Read with Millis().
+extern volatile uint32_t Milliseconds;
+
+// Sync the controller. MUST HAVE! A routine for scripts to list in their
+// Routines table.
+extern const Step_t SyncController[] PROGMEM;
+
+// Provided by each script: its routines, in flash. The program starts at the
+// first one.
+extern const Step_t* const Routines[] PROGMEM;
+
+// A routine written in C, for what the bytecode can't express. It's called
+// for every report while the program is on its NATIVE instruction: it fills
+// the report in (starting neutral) and returns its duration in ticks, or
+// NATIVE_DONE, leaving the report alone, for the program to move on.
+// `starting` is set on the first call after the program got to the
+// instruction, including after the program restarted halfway through.
+typedef uint16_t (*Native_t)(USB_JoystickReport_Input_t* const ReportData, bool starting);
+#define NATIVE_DONE 0xFFFF
+
+// Provided by scripts that have natives, in flash.
+extern const Native_t Natives[] PROGMEM;
+
+// Function Prototypes
+// Setup all necessary hardware, including USB initialization.
+void SetupHardware(void);
+// Process and deliver data from IN and OUT endpoints.
+void HID_Task(void);
+// USB device event handlers.
+void EVENT_USB_Device_Connect(void);
+void EVENT_USB_Device_Disconnect(void);
+void EVENT_USB_Device_ConfigurationChanged(void);
+void EVENT_USB_Device_ControlRequest(void);
+#ifdef PROFILE
+// Profiling build for bench/, without USB: polls the script itself.
+#ifndef PROFILE_POLL_MS
+#define PROFILE_POLL_MS 8
+#endif
+void ProfileTask(void);
+#endif
+// Returns Milliseconds, read atomically.
+uint32_t Millis(void);
+// Build the next report ahead of time, unless it's built already.
+void PrepareReport(void);
+// Start the program over from its first routine, from the next report on.
+// Safe to call from an interrupt.
+void RestartProgram(void);
+// Marks the report being built, as MARK does, for natives.
+void SetMark(uint8_t id);
+// Get the report for the host's current poll.
+const USB_JoystickReport_Input_t* GetNextReport(void);
+
+#endif
@@ -0,0 +1,84 @@
+/*
+  Generated by mac2c.py from Joystick.mac. Do not edit; edit the .mac file and
+  run "python mac2c.py Joystick.mac" again.
+*/
+
+enum {
+  MAIN,
+  SYNC,
+  RECALL,
+  GET_EGG,
+};
+
+// 39 bytes
+const Step_t Main[] PROGMEM = {
+  CALL(SYNC),
+  SET_REG(R0, 1),
+  FOREVER,
+  MARK(1),
+  CALL(GET_EGG),
+  CALL(RECALL),
+  MARK(2),
+  LOOP(55),
+  MOVE(POS_RIGHT, 75),
+  STEP(SWITCH_B, POS_RIGHT, 10),
+  NEXT,
+  CALL(RECALL),
+  ADD_REG(R0, 1),
+  SKIP_IF_NE(R0, 6),
+  SET_REG(R0, 1),
+  NEXT,
+  END,
+};
+
+// 25 bytes
+const Step_t Recall[] PROGMEM = {
+  WAIT(75),
+  PRESS(SWITCH_X),
+  WAIT(75),
+  PRESS(SWITCH_A),
+  WAIT(300),
+  STEP_STICK(0, 170, 128, 25),
+  WAIT(75),
+  PRESS(SWITCH_A),
+  WAIT(75),
+  PRESS(SWITCH_A),
+  WAIT(300),
+  RET,
+};
+
+// 48 bytes
+const Step_t GetEgg[] PROGMEM = {
+  WAIT(300),
+  PRESS(SWITCH_PLUS),
+  MOVE(POS_UP_LEFT, 300),
+  PRESS(SWITCH_A),
+  WAIT(75),
+  PRESS(SWITCH_A),
+  WAIT(600),
+  PRESS(SWITCH_B),
+  WAIT(200),
+  PRESS(SWITCH_A),
+  WAIT(75),
+  PRESS(SWITCH_B),
+  WAIT(300),
+  LOOP_REG(R0),
+  MOVE(POS_DOWN, 25),
+  WAIT(75),
+  NEXT,
+  PRESS(SWITCH_A),
+  WAIT(300),
+  PRESS(SWITCH_A),
+  WAIT(200),
+  PRESS(SWITCH_A),
+  WAIT(200),
+  PRESS(SWITCH_PLUS),
+  RET,
+};
+
+const Step_t* const Routines[] PROGMEM = {
+  [MAIN] = Main,
+  [SYNC] = SyncController,
+  [RECALL] = Recall,
+  [GET_EGG] = GetEgg,
+};
@@ -0,0 +1,388 @@
+/*
+Nintendo Switch Fightstick - Proof-of-Concept
+
+Based on the LUFA library's Low-Level Joystick Demo
+	(C) Dean Camera
+Based on the HORI's Pokken Tournament Pro Pad design
+	(C) HORI
+
+This project implements a modified version of HORI's Pokken Tournament Pro Pad
+USB descriptors to allow for the creation of custom controllers for the
+Nintendo Switch. This also works to a limited degree on the PS3.
+
+Since System Update v3.0.0, the Nintendo Switch recognizes the Pokken
+Tournament Pro Pad as a Pro Controller. Physical design limitations prevent
+the Pokken Controller from functioning at the same level as the Pro
+Controller. However, by default most of the descriptors are there, with the
+exception of Home and Capture. Descriptor modification allows us to unlock
+these buttons for our use.
+*/
+
+/** \file
+ *
+ *  Script loader, for firmwares built with SCRIPT_UPLOAD: a PC uploads a
+ *  compiled script (../upload.py) over the AVR's hardware UART (USART1), it's
+ *  written into SCRIPT_FLASH_SIZE bytes of flash kept for it, and the engine
+ *  runs it in place of the script the firmware was built with, until the next
+ *  upload, power cycles included. One firmware then does every job, and a
+ *  new one takes seconds rather than a reflash.
+ *
+ *  The AVR can only write its flash from the bootloader section, so pages
+ *  are written through LUFA's bootloader API, which LUFA's DFU and CDC
+ *  bootloaders have at the end of flash; without it, uploads are refused.
+ *  Nothing can run from flash while a page is written, interrupts included,
+ *  so they're off for its 8 ms or so: the PC is stopped with XOFF first, and
+ *  the page is only written once the line is quiet, then XON lets it go on.
+ *  The receive interrupt puts bytes into a ring holding the page and what
+ *  comes after XOFF; UploadTask, in the main loop, writes the pages.
+ *
+ *  While a script comes in, the engine's routines end at once, so the
+ *  controller is neutral. Once it's all written, it's checked against its
+ *  CRC and the engine starts over with it; the PC is told "OK" with the
+ *  script's size, or "ERR" and why it failed. A script that fails its check
+ *  at power-up, say because the upload was cut short, isn't run: the
+ *  firmware's own script is.
+ */
+
+#ifdef SCRIPT_UPLOAD
+
+#include <util/crc16.h>
+
+#include "Upload.h"
+
+#define BUFFER_MASK (UPLOAD_BUFFER - 1)
+#define TX_MASK     (UPLOAD_TX_BUFFER - 1)
+
+#ifndef FLASH_HOOK
+// LUFA's bootloader API: a table of jumps at the end of flash, ending with a
+// signature, with a page erased, filled a word at a time, then written.
+#define BOOTLOADER_API_TABLE_SIZE        32
+#define BOOTLOADER_API_TABLE_START       ((FLASHEND + 1UL) - BOOTLOADER_API_TABLE_SIZE)
+#define BOOTLOADER_API_CALL(index)       (void*)((BOOTLOADER_API_TABLE_START + (index) * 2) / 2)
+#define BOOTLOADER_MAGIC_SIGNATURE_START (BOOTLOADER_API_TABLE_START + (BOOTLOADER_API_TABLE_SIZE - 2))
+#define BOOTLOADER_MAGIC_SIGNATURE       0xDCFB
+
+static void (* const BootloaderAPI_ErasePage)(uint32_t Address) = BOOTLOADER_API_CALL(0);
+static void (* const BootloaderAPI_WritePage)(uint32_t Address) = BOOTLOADER_API_CALL(1);
+static void (* const BootloaderAPI_FillWord)(uint32_t Address, uint16_t Word) = BOOTLOADER_API_CALL(2);
+
+static bool HasBootloader(void) {
+	#if FLASHEND > 0xFFFF
+	return pgm_read_word_far(BOOTLOADER_MAGIC_SIGNATURE_START) == BOOTLOADER_MAGIC_SIGNATURE;
+	#else
+	return pgm_read_word(BOOTLOADER_MAGIC_SIGNATURE_START) == BOOTLOADER_MAGIC_SIGNATURE;
+	#endif
+}
+#else
+#define HasBootloader() true
+#endif
+
+// The flash kept for uploads, erased, on pages of its own. Where FLASH_HOOK
+// writes it, it's ordinary memory, so it isn't const there, lest the
+// compiler take it for erased flash for good.
+#ifdef FLASH_HOOK
+#define SCRIPT_FLASH_CONST
+#else
+#define SCRIPT_FLASH_CONST const
+#endif
+static SCRIPT_FLASH_CONST uint8_t ScriptFlash[SCRIPT_FLASH_SIZE] __attribute__((aligned(SPM_PAGESIZE))) PROGMEM = {
+	[0 ... SCRIPT_FLASH_SIZE - 1] = 0xFF
+};
+
+// What the engine runs while a script comes in.
+static const Step_t Idle[] PROGMEM = {
+	END
+};
+
+// The uploaded script's number of routines once it's been checked, 0 if it
+// failed, and its length.
+static bool checked = false;
+static uint8_t routines = 0;
+static uint16_t length = 0;
+
+// The upload coming in: bytes received, the first at Buffer[0], and how many
+// there are in all, once the header's in; and those written to flash, by
+// UploadTask only.
+static volatile uint8_t Buffer[UPLOAD_BUFFER];
+static volatile uint16_t received = 0;
+static volatile uint16_t total = 0;
+static volatile uint16_t written = 0;
+// Whether an upload is coming in, bytes are being ignored after a failed
+// one, and the ring overflowed.
+static volatile bool receiving = false;
+static volatile bool draining = false;
+static volatile bool overrun = false;
+// When the last byte came, in Milliseconds.
+static volatile uint32_t last_byte_at = 0;
+
+// Text and flow control for the PC, from tx_tail, moved by the transmit
+// interrupt only, up to tx_head.
+static volatile uint8_t TxRing[UPLOAD_TX_BUFFER];
+static volatile uint8_t tx_head = 0;
+static volatile uint8_t tx_tail = 0;
+
+// Whether the UART is set up, the upload coming in has been started on, and
+// the PC was told to stop.
+static bool ready = false;
+static bool started = false;
+static bool paused = false;
+
+// Looks the uploaded script over: its header, its CRC and its routines.
+static void Check(void) {
+	uint16_t crc = 0xFFFF, at, offset;
+	uint8_t count = pgm_read_byte(&ScriptFlash[4]);
+
+	checked = true;
+	routines = 0;
+	length = pgm_read_word(&ScriptFlash[2]);
+	if (pgm_read_word(&ScriptFlash[0]) != UPLOAD_MAGIC || pgm_read_byte(&ScriptFlash[5]) != UPLOAD_VERSION
+		|| length > SCRIPT_FLASH_SIZE - UPLOAD_HEADER || count == 0 || 2 * count > length)
+		return;
+	for (at = 0; at < length; at++)
+		crc = _crc_xmodem_update(crc, pgm_read_byte(&ScriptFlash[UPLOAD_HEADER + at]));
+	if (crc != pgm_read_word(&ScriptFlash[6]))
+		return;
+	for (at = 0; at < count; at++)
+	{
+		offset = pgm_read_word(&ScriptFlash[UPLOAD_HEADER + 2 * at]);
+		if (offset != UPLOAD_SYNC && offset >= length)
+			return;
+	}
+	routines = count;
+}
+
+const Step_t* UploadedRoutine(uint8_t routine) {
+	uint16_t offset;
+
+	if (!checked)
+		Check();
+	if (receiving)
+		return Idle;
+	if (routines == 0)
+		return NULL;
+	if (routine >= routines)
+		return Idle;
+	offset = pgm_read_word(&ScriptFlash[UPLOAD_HEADER + 2 * routine]);
+	return offset == UPLOAD_SYNC ? SyncController : &ScriptFlash[UPLOAD_HEADER + offset];
+}
+
+// Double speed, 8N1, both interrupts on; the transmit one says XON, for the
+// PC to start on.
+static void UploadInit(void) {
+	UBRR1 = (F_CPU + 4UL * UPLOAD_BAUD) / (8UL * UPLOAD_BAUD) - 1;
+	UCSR1A = (1 << U2X1);
+	UCSR1C = (1 << UCSZ11) | (1 << UCSZ10);
+	UCSR1B = (1 << RXCIE1) | (1 << RXEN1) | (1 << TXEN1);
+	ready = true;
+}
+
+ISR(USART1_RX_vect) {
+	uint8_t c = UDR1;
+
+	last_byte_at = Milliseconds;
+	if (draining)
+		return;
+	// Wait for the header's "SC"
+	if (!receiving && received == 0 && c != (UPLOAD_MAGIC & 0xFF))
+		return;
+	if (!receiving && received == 1 && c != (UPLOAD_MAGIC >> 8))
+	{
+		received = 0;
+		return;
+	}
+	if (total && received == total)
+		return;
+	if (received - written >= UPLOAD_BUFFER)
+	{
+		overrun = true;
+		return;
+	}
+	Buffer[received & BUFFER_MASK] = c;
+	received++;
+	if (received == 2)
+		receiving = true;
+	else if (received == UPLOAD_HEADER)
+		total = UPLOAD_HEADER + (Buffer[2] | Buffer[3] << 8);
+}
+
+// Sends the text queued, then goes quiet.
+ISR(USART1_UDRE_vect) {
+	if (tx_tail != tx_head)
+	{
+		UDR1 = TxRing[tx_tail];
+		tx_tail = (tx_tail + 1) & TX_MASK;
+	}
+	else
+	{
+		UCSR1B &= ~(1 << UDRIE1);
+	}
+}
+
+// Queues a byte for the PC, dropping it if there's no room.
+static void Send(char c) {
+	uint8_t next = (tx_head + 1) & TX_MASK;
+
+	if (next == tx_tail)
+		return;
+	TxRing[tx_head] = c;
+	tx_head = next;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		UCSR1B |= (1 << UDRIE1);
+	}
+}
+
+static void SendText(const char* text) {
+	char c;
+
+	while ((c = pgm_read_byte(text++)))
+		Send(c);
+}
+
+static void SendNumber(uint16_t n) {
+	char digits[5];
+	uint8_t i = 0;
+
+	do
+	{
+		digits[i++] = '0' + n % 10;
+		n /= 10;
+	} while (n);
+	while (i)
+		Send(digits[--i]);
+}
+
+// The byte of the upload at `at`, erased flash past its end.
+static uint8_t ImageByte(uint16_t at, uint16_t end) {
+	return at < end ? Buffer[at & BUFFER_MASK] : 0xFF;
+}
+
+// Writes the page of the upload at `at`.
+static void WritePage(uint16_t at, uint16_t end) {
+	uint16_t i;
+	#ifdef FLASH_HOOK
+	uint8_t page[SPM_PAGESIZE];
+
+	for (i = 0; i < SPM_PAGESIZE; i++)
+		page[i] = ImageByte(at + i, end);
+	FLASH_HOOK(&ScriptFlash[at], page);
+	#else
+	uint32_t address = (uint16_t)&ScriptFlash[at];
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		BootloaderAPI_ErasePage(address);
+		for (i = 0; i < SPM_PAGESIZE; i += 2)
+			BootloaderAPI_FillWord(address + i, ImageByte(at + i, end) | ImageByte(at + i + 1, end) << 8);
+		BootloaderAPI_WritePage(address);
+	}
+	#endif
+}
+
+// Ends the upload, telling the PC how it went, NULL meaning it went well,
+// and starts the script over: the one uploaded, the one before if the
+// upload failed before any of it was written, or else the firmware's own.
+static void Finish(const char* error) {
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		receiving = false;
+		draining = error != NULL;
+		received = total = written = 0;
+		overrun = false;
+	}
+	started = false;
+	if (paused)
+	{
+		paused = false;
+		Send(XON);
+	}
+	Check();
+	if (error)
+	{
+		SendText(PSTR("ERR "));
+		SendText(error);
+	}
+	else
+	{
+		SendText(PSTR("OK "));
+		SendNumber(length);
+		SendText(PSTR(" bytes, "));
+		SendNumber(routines);
+		SendText(PSTR(" routines"));
+	}
+	SendText(PSTR("\r\n"));
+	RestartProgram();
+}
+
+void UploadTask(void) {
+	uint16_t have, end;
+	uint32_t quiet;
+
+	if (!ready)
+	{
+		UploadInit();
+		Send(XON);
+	}
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		have = received;
+		end = total;
+		quiet = Milliseconds - last_byte_at;
+	}
+	if (draining && quiet >= UPLOAD_DRAIN_MS)
+		draining = false;
+	if (!receiving)
+		return;
+
+	// Stop the script at once, before any of it is overwritten
+	if (!started)
+	{
+		started = true;
+		RestartProgram();
+		if (!HasBootloader())
+		{
+			Finish(PSTR("no bootloader"));
+			return;
+		}
+	}
+	if (overrun)
+	{
+		Finish(PSTR("overrun"));
+		return;
+	}
+	if (end > SCRIPT_FLASH_SIZE)
+	{
+		Finish(PSTR("too long"));
+		return;
+	}
+
+	// A page is in, or the last of the script: stop the PC, and write it
+	// once the line is quiet
+	if (have - written >= SPM_PAGESIZE || (end && have == end && written < end))
+	{
+		if (!paused)
+		{
+			paused = true;
+			Send(XOFF);
+		}
+		if (quiet < UPLOAD_QUIET_MS)
+			return;
+		WritePage(written, end);
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+			written += SPM_PAGESIZE;
+		}
+		return;
+	}
+	if (paused)
+	{
+		paused = false;
+		Send(XON);
+	}
+	if (end && written >= end)
+	{
+		Check();
+		Finish(routines ? NULL : PSTR("crc"));
+	}
+	else if (quiet >= UPLOAD_TIMEOUT_MS)
+	{
+		Finish(PSTR("timeout"));
+	}
+}
+
+#endif
@@ -0,0 +1,100 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2014.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2014  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Header file for Upload.c, the script loader of firmwares built with
+ *  SCRIPT_UPLOAD.
+ */
+
+#ifndef _UPLOAD_H_
+#define _UPLOAD_H_
+
+/* Includes: */
+#include "Engine.h"
+
+/* Macros: */
+// Flash kept for uploaded scripts, header included, a multiple of
+// SPM_PAGESIZE.
+#ifndef SCRIPT_FLASH_SIZE
+#define SCRIPT_FLASH_SIZE 2048
+#endif
+
+// The UART's speed, in bits per second, as the streaming firmware's.
+#ifndef UPLOAD_BAUD
+#define UPLOAD_BAUD 115200
+#endif
+
+// An uploaded script is a header, "SC", the length of the program after it,
+// its number of routines, UPLOAD_VERSION, and the CRC-16
+// (_crc_xmodem_update, from 0xFFFF) of the program, 16-bit values low byte
+// first; then the program: the offset of each routine in it, UPLOAD_SYNC for
+// SyncController, and the routines' bytecode. ../mac2c.py makes it.
+#define UPLOAD_HEADER  8
+#define UPLOAD_MAGIC   ('S' | 'C' << 8)
+#define UPLOAD_VERSION 1
+#define UPLOAD_SYNC    0xFFFF
+
+// A page is written once no byte came for UPLOAD_QUIET_MS after XOFF. An
+// upload is dropped when no byte came for UPLOAD_TIMEOUT_MS, and after a
+// failed one, bytes are ignored until none came for UPLOAD_DRAIN_MS.
+#define UPLOAD_QUIET_MS   2
+#define UPLOAD_TIMEOUT_MS 1000
+#define UPLOAD_DRAIN_MS   100
+
+// Bytes received ahead of the page being written: a page, and room for what
+// comes after XOFF. Text for the PC goes through a ring of UPLOAD_TX_BUFFER
+// bytes. Both are powers of 2.
+#define UPLOAD_BUFFER    (2 * SPM_PAGESIZE)
+#define UPLOAD_TX_BUFFER 32
+
+#define XON  0x11
+#define XOFF 0x13
+
+#if SCRIPT_FLASH_SIZE % SPM_PAGESIZE
+#error "SCRIPT_FLASH_SIZE must be a multiple of SPM_PAGESIZE"
+#endif
+
+/* Function Prototypes: */
+// Takes uploads in, from the main loop: writes each page as it comes, and
+// answers once the script is checked.
+void UploadTask(void);
+// Routine `routine` of the uploaded script, NULL if there's none, or a
+// routine that ends at once while one is coming in.
+const Step_t* UploadedRoutine(uint8_t routine);
+
+// FLASH_HOOK names a function called to write a page of flash, at `page`,
+// with SPM_PAGESIZE bytes of `data`, defined by builds without LUFA's
+// bootloader API, such as the host build.
+#ifdef FLASH_HOOK
+void FLASH_HOOK(const uint8_t* page, const uint8_t* data);
+#endif
+
+#endif
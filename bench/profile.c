@@ -0,0 +1,202 @@
+/** \file
+ *
+ *  Runs a script's profiling build (-DPROFILE) under simavr and counts the CPU
+ *  cycles spent answering each poll (GPIOR0 at 1) and building each report
+ *  ahead of time (GPIOR0 at 2), timer interrupts included. Reports the min,
+ *  mean and max of both, the builds per mark (GPIOR1) too, where the worst
+ *  ones happened, and flags a script whose worst takes more than a share of
+ *  the 1 ms USB frame.
+ *
+ *    build/profile [-m mcu] [-t limit_ms] [-w percent] build/<script>.elf
+ *
+ *  -m names the MCU if the .elf doesn't (default atmega32u4), -t sets how long
+ *  to run in simulated time (default 20000 ms), and -w the share of a frame
+ *  either may take (default 50%). Exits with 1 if one took longer.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <simavr/sim_avr.h>
+#include <simavr/sim_elf.h>
+#include <simavr/sim_io.h>
+
+// Data space addresses of GPIOR0 and GPIOR1, the same on the ATmega32u4 and
+// the AT90USB1286.
+#define GPIOR0_ADDR 0x3E
+#define GPIOR1_ADDR 0x4A
+
+typedef struct {
+	uint32_t count;
+	uint64_t total;
+	uint32_t min;
+	uint32_t max;
+} Stats_t;
+
+// What GPIOR0 brackets.
+enum {
+	IDLE,
+	POLL,
+	BUILD,
+};
+
+static const char* const KindNames[] = {
+	[POLL] = "poll",
+	[BUILD] = "build",
+};
+
+static Stats_t Overall[3];
+static Stats_t ByMark[256];
+static uint8_t Mark = 0;
+static uint8_t Kind = IDLE;
+static avr_cycle_count_t Start;
+static avr_cycle_count_t WorstAt[3];
+static uint8_t WorstMark[3];
+
+static void Record(Stats_t* stats, uint32_t cycles) {
+	if (stats->count == 0 || cycles < stats->min)
+		stats->min = cycles;
+	if (cycles > stats->max)
+		stats->max = cycles;
+	stats->total += cycles;
+	stats->count++;
+}
+
+static void WriteGPIOR0(avr_t* avr, avr_io_addr_t addr, uint8_t v, void* param) {
+	avr->data[addr] = v;
+	if (v == POLL || v == BUILD)
+	{
+		Start = avr->cycle;
+		Kind = v;
+	}
+	else if (Kind != IDLE)
+	{
+		uint32_t cycles = avr->cycle - Start;
+		if (cycles > Overall[Kind].max)
+		{
+			WorstAt[Kind] = avr->cycle;
+			WorstMark[Kind] = Mark;
+		}
+		Record(&Overall[Kind], cycles);
+		if (Kind == BUILD)
+			Record(&ByMark[Mark], cycles);
+		Kind = IDLE;
+	}
+}
+
+static void WriteGPIOR1(avr_t* avr, avr_io_addr_t addr, uint8_t v, void* param) {
+	avr->data[addr] = v;
+	Mark = v;
+}
+
+static void PrintStats(const char* name, const Stats_t* stats, uint32_t budget) {
+	printf("  %-10s %8lu %8lu %10.1f %8lu %6.1f%%\n", name, (unsigned long)stats->count,
+		(unsigned long)stats->min, (double)stats->total / stats->count,
+		(unsigned long)stats->max, 100.0 * stats->max / budget);
+}
+
+static void Usage(const char* name) {
+	fprintf(stderr, "usage: %s [-m mcu] [-t limit_ms] [-w percent] script.elf\n", name);
+	exit(2);
+}
+
+int main(int argc, char* argv[]) {
+	const char* mcu = "atmega32u4";
+	unsigned long limit = 20000;
+	unsigned long warn = 50;
+	elf_firmware_t firmware;
+	avr_t* avr;
+	int opt;
+	int state;
+	uint32_t budget;
+	int i;
+
+	while ((opt = getopt(argc, argv, "m:t:w:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'm':
+				mcu = optarg;
+				break;
+			case 't':
+				limit = strtoul(optarg, NULL, 10);
+				break;
+			case 'w':
+				warn = strtoul(optarg, NULL, 10);
+				break;
+			default:
+				Usage(argv[0]);
+		}
+	}
+	if (optind != argc - 1)
+		Usage(argv[0]);
+
+	memset(&firmware, 0, sizeof(firmware));
+	if (elf_read_firmware(argv[optind], &firmware) != 0)
+	{
+		fprintf(stderr, "%s: cannot read firmware\n", argv[optind]);
+		return 2;
+	}
+	if (firmware.mmcu[0])
+		mcu = firmware.mmcu;
+	avr = avr_make_mcu_by_name(mcu);
+	if (!avr)
+	{
+		fprintf(stderr, "%s: unknown MCU\n", mcu);
+		return 2;
+	}
+	avr_init(avr);
+	avr_load_firmware(avr, &firmware);
+	if (!avr->frequency)
+		avr->frequency = 16000000;
+	avr_register_io_write(avr, GPIOR0_ADDR, WriteGPIOR0, NULL);
+	avr_register_io_write(avr, GPIOR1_ADDR, WriteGPIOR1, NULL);
+
+	// One USB frame, in cycles.
+	budget = avr->frequency / 1000;
+
+	do
+		state = avr_run(avr);
+	while (state != cpu_Done && state != cpu_Crashed &&
+		avr->cycle < (avr_cycle_count_t)limit * (avr->frequency / 1000));
+
+	if (state == cpu_Crashed)
+		printf("%s: crashed at %lu ms\n", argv[optind],
+			(unsigned long)(avr->cycle / (avr->frequency / 1000)));
+	if (Overall[POLL].count == 0 || Overall[BUILD].count == 0)
+	{
+		printf("%s: no report built\n", argv[optind]);
+		return 1;
+	}
+
+	printf("%s on %s at %lu Hz, %lu ms: cycles per poll and per report built\n",
+		argv[optind], mcu, (unsigned long)avr->frequency, limit);
+	printf("  %-10s %8s %8s %10s %8s %7s\n", "", "count", "min", "mean", "max", "frame");
+	PrintStats(KindNames[POLL], &Overall[POLL], budget);
+	PrintStats(KindNames[BUILD], &Overall[BUILD], budget);
+	for (i = 0; i < 256; i++)
+	{
+		char name[16];
+		if (ByMark[i].count == 0)
+			continue;
+		snprintf(name, sizeof(name), "  mark %d", i);
+		PrintStats(name, &ByMark[i], budget);
+	}
+	for (i = POLL; i <= BUILD; i++)
+		printf("  worst %s at %lu ms, mark %u\n", KindNames[i],
+			(unsigned long)(WorstAt[i] / (avr->frequency / 1000)), WorstMark[i]);
+
+	for (i = POLL; i <= BUILD; i++)
+	{
+		if (Overall[i].max * 100 > (uint64_t)budget * warn)
+		{
+			printf("  OVER BUDGET: the worst %s takes more than %lu%% of a %lu-cycle frame\n",
+				KindNames[i], warn, (unsigned long)budget);
+			return 1;
+		}
+	}
+	return 0;
+}
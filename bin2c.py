@@ -1,47 +1,54 @@
 #!/bin/python
 
-import sys, getopt
+import sys, os, getopt
+
+import imagec
 
 def main(argv):
-  opts, args = getopt.getopt(argv, "hi")
+  opts, args = getopt.getopt(argv, "hiw:x:y:")
 
   invertColormap = False
+  width = imagec.CANVAS_WIDTH
+  x, y = 0, 0
   for opt, arg in opts:
     if opt == '-h':
       usage()
       sys.exit()
     elif opt == '-i':
       invertColormap = True
-
-  data = open(args[0], 'rb').read()
-
-  str_out = "#include <stdint.h>\n#include <avr/pgmspace.h>\n\nconst uint8_t image_data[0x12c1] PROGMEM = {"
-  for i in range(0, (320*120) / 8):
-    val = 0;
-
-    for j in range(0, 8):
-        val |= ord(data[(i * 8) + j]) << j
-
-    if (invertColormap):
-      val = ~val & 0xFF;
-    else:
-      val = val & 0xFF;
-
-    str_out += hex(val) + ", "
-
-  str_out += "0x0};\n"
-
-  with open('image.c', 'w') as f:
-    f.write(str_out)
+    elif opt == '-w':
+      width = int(arg)
+    elif opt == '-x':
+      x = int(arg)
+    elif opt == '-y':
+      y = int(arg)
+
+  # One byte per pixel, row after row
+  data = bytearray(open(args[0], 'rb').read())
+  height = len(data) // width
+  if not imagec.check_fits(width, height, x, y):
+    sys.exit()
+
+  rows = []
+  for i in range(0, height):
+    row = []
+    for j in range(0, width):
+      val = data[(i * width) + j] & 1
+      row.append(val ^ 1 if invertColormap else val)
+    rows.append(row)
+
+  raw, size = imagec.write(rows, x, y, os.path.basename(args[0]), 'bin2c.py')
 
   if (invertColormap):
-      print("{} converted with inverted colormap and saved to image.c".format(args[0]))
+      print("{} converted with inverted colormap and saved to image.c and image.h".format(args[0]))
   else:
-      print("{} converted with original colormap and saved to image.c".format(args[0]))
+      print("{} converted with original colormap and saved to image.c and image.h".format(args[0]))
+  print("{} bytes run-length coded, {} bytes raw".format(size, raw))
 
 def usage():
   print("To convert to image.c: bin2c.py yourImage.data")
   print("To convert to an inverted image.c: bin2c.py -i yourImage.data")
+  print("To convert a smaller image, 64 pixels wide, placed on the canvas: bin2c.py -w 64 -x 100 -y 20 yourImage.data")
 
 if __name__ == "__main__":
   if len(sys.argv[1:]) == 0:
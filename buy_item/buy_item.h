@@ -30,102 +30,13 @@
 
 /** \file
  *
- *  Header file for Joystick.c.
+ *  Header file for buy_item.c.
  */
 
 #ifndef _BUY_ITEM_H_
 #define _BUY_ITEM_H_
 
 /* Includes: */
-#include <avr/io.h>
-#include <avr/wdt.h>
-#include <avr/power.h>
-#include <avr/interrupt.h>
-#include <avr/pgmspace.h>
-#include <string.h>
-
-#include <LUFA/Drivers/USB/USB.h>
-#include <LUFA/Drivers/Board/Joystick.h>
-#include <LUFA/Drivers/Board/LEDs.h>
-#include <LUFA/Drivers/Board/Buttons.h>
-#include <LUFA/Platform/Platform.h>
-
-#include "../Descriptors.h"
-
-// Type Defines
-// Enumeration for joystick buttons.
-typedef enum {
-	SWITCH_Y       = 0x01,
-	SWITCH_B       = 0x02,
-	SWITCH_A       = 0x04,
-	SWITCH_X       = 0x08,
-	SWITCH_L       = 0x10,
-	SWITCH_R       = 0x20,
-	SWITCH_ZL      = 0x40,
-	SWITCH_ZR      = 0x80,
-	SWITCH_MINUS   = 0x100,
-	SWITCH_PLUS    = 0x200,
-	SWITCH_LCLICK  = 0x400,
-	SWITCH_RCLICK  = 0x800,
-	SWITCH_HOME    = 0x1000,
-	SWITCH_CAPTURE = 0x2000,
-} JoystickButtons_t;
-
-#define HAT_TOP          0x00
-#define HAT_TOP_RIGHT    0x01
-#define HAT_RIGHT        0x02
-#define HAT_BOTTOM_RIGHT 0x03
-#define HAT_BOTTOM       0x04
-#define HAT_BOTTOM_LEFT  0x05
-#define HAT_LEFT         0x06
-#define HAT_TOP_LEFT     0x07
-#define HAT_CENTER       0x08
-
-#define STICK_MIN      0
-#define STICK_CENTER 128
-#define STICK_MAX    255
-
-// Joystick HID report structure. We have an input and an output.
-typedef struct {
-	uint16_t Button; // 16 buttons; see JoystickButtons_t for bit mapping
-	uint8_t  HAT;    // HAT switch; one nibble w/ unused nibble
-	uint8_t  LX;     // Left  Stick X
-	uint8_t  LY;     // Left  Stick Y
-	uint8_t  RX;     // Right Stick X
-	uint8_t  RY;     // Right Stick Y
-	uint8_t  VendorSpec;
-} USB_JoystickReport_Input_t;
-
-// The output is structured as a mirror of the input.
-// This is based on initial observations of the Pokken Controller.
-typedef struct {
-	uint16_t Button; // 16 buttons; see JoystickButtons_t for bit mapping
-	uint8_t  HAT;    // HAT switch; one nibble w/ unused nibble
-	uint8_t  LX;     // Left  Stick X
-	uint8_t  LY;     // Left  Stick Y
-	uint8_t  RX;     // Right Stick X
-	uint8_t  RY;     // Right Stick Y
-} USB_JoystickReport_Output_t;
-
-// This specifies a single step, i.e. which buttons should be pressed for
-// how long a duration.
-typedef struct {
-  uint16_t Button;
-  uint8_t LX;
-  uint8_t LY; 
-  int Duration;
-} Step_t;
-// Function Prototypes
-// Setup all necessary hardware, including USB initialization.
-void SetupHardware(void);
-// Process and deliver data from IN and OUT endpoints.
-void HID_Task(void);
-// USB device event handlers.
-void EVENT_USB_Device_Connect(void);
-void EVENT_USB_Device_Disconnect(void);
-void EVENT_USB_Device_ConfigurationChanged(void);
-void EVENT_USB_Device_ControlRequest(void);
-// Prepare the next report for the host.
-void GetNextReport(USB_JoystickReport_Input_t* const ReportData);
+#include "../Engine.h"
 
 #endif
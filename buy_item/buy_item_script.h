@@ -0,0 +1,39 @@
+/*
+  Generated by mac2c.py from buy_item.mac. Do not edit; edit the .mac file and
+  run "python mac2c.py buy_item.mac" again.
+*/
+
+enum {
+  MAIN,
+  SYNC,
+};
+
+// 41 bytes
+const Step_t Main[] PROGMEM = {
+  CALL(SYNC),
+  LOOP(80),
+  MARK(1),
+  PRESS(SWITCH_A),
+  WAIT(50),
+  PRESS(SWITCH_B),
+  WAIT(100),
+  PRESS(SWITCH_B),
+  WAIT(50),
+  MOVE(POS_DOWN, 25),
+  WAIT(50),
+  PRESS(SWITCH_A),
+  WAIT(50),
+  PRESS(SWITCH_B),
+  WAIT(100),
+  PRESS(SWITCH_B),
+  WAIT(200),
+  PRESS(SWITCH_B),
+  WAIT(50),
+  NEXT,
+  END,
+};
+
+const Step_t* const Routines[] PROGMEM = {
+  [MAIN] = Main,
+  [SYNC] = SyncController,
+};
@@ -0,0 +1,83 @@
+/*
+  Generated by mac2c.py from challenge_league.mac. Do not edit; edit the .mac file and
+  run "python mac2c.py challenge_league.mac" again.
+*/
+
+enum {
+  MAIN,
+  SYNC,
+  START_CHALLENGE,
+  ENTER_FIGHT,
+  FIGHT,
+};
+
+// 29 bytes
+const Step_t Main[] PROGMEM = {
+  CALL(SYNC),
+  FOREVER,
+  MARK(1),
+  CALL(START_CHALLENGE),
+  LOOP(3),
+  MARK(2),
+  CALL(ENTER_FIGHT),
+  CALL(FIGHT),
+  NEXT,
+  MARK(3),
+  LOOP(80),
+  PRESS(SWITCH_A),
+  WAIT(50),
+  NEXT,
+  NEXT,
+  END,
+};
+
+// 19 bytes
+const Step_t StartChallenge[] PROGMEM = {
+  MOVE(POS_UP, 200),
+  LOOP(5),
+  PRESS(SWITCH_A),
+  WAIT(50),
+  NEXT,
+  PRESS(SWITCH_B),
+  WAIT(50),
+  PRESS(SWITCH_A),
+  WAIT(500),
+  RET,
+};
+
+// 15 bytes
+const Step_t EnterFight[] PROGMEM = {
+  PRESS(SWITCH_A),
+  WAIT(50),
+  MOVE(POS_UP, 300),
+  LOOP(90),
+  PRESS(SWITCH_B),
+  WAIT(50),
+  NEXT,
+  RET,
+};
+
+// 25 bytes
+const Step_t Fight[] PROGMEM = {
+  PRESS(SWITCH_A),
+  WAIT(50),
+  MOVE(POS_LEFT, 25),
+  WAIT(50),
+  PRESS(SWITCH_A),
+  WAIT(50),
+  MOVE(POS_DOWN, 25),
+  WAIT(50),
+  LOOP(420),
+  PRESS(SWITCH_A),
+  WAIT(50),
+  NEXT,
+  RET,
+};
+
+const Step_t* const Routines[] PROGMEM = {
+  [MAIN] = Main,
+  [SYNC] = SyncController,
+  [START_CHALLENGE] = StartChallenge,
+  [ENTER_FIGHT] = EnterFight,
+  [FIGHT] = Fight,
+};
@@ -0,0 +1,114 @@
+/*
+  Generated by mac2c.py from delete_box.mac. Do not edit; edit the .mac file and
+  run "python mac2c.py delete_box.mac" again.
+*/
+
+enum {
+  MAIN,
+  SYNC,
+  DELETE_POKEMON,
+  ADVANCE,
+  GO_RIGHT,
+  NEXT_LINE,
+  NEXT_PAGE,
+};
+
+// 25 bytes
+const Step_t Main[] PROGMEM = {
+  CALL(SYNC),
+  PRESS(SWITCH_X),
+  WAIT(50),
+  PRESS(SWITCH_A),
+  WAIT(300),
+  PRESS(SWITCH_R),
+  WAIT(400),
+  LOOP(540),
+  MARK(1),
+  CALL(DELETE_POKEMON),
+  CALL(ADVANCE),
+  NEXT,
+  END,
+};
+
+// 29 bytes
+const Step_t DeletePokemon[] PROGMEM = {
+  PRESS(SWITCH_A),
+  WAIT(50),
+  MOVE(POS_UP, 25),
+  WAIT(50),
+  MOVE(POS_UP, 25),
+  WAIT(50),
+  PRESS(SWITCH_A),
+  WAIT(75),
+  MOVE(POS_UP, 25),
+  WAIT(50),
+  PRESS(SWITCH_A),
+  WAIT(200),
+  PRESS(SWITCH_A),
+  WAIT(50),
+  RET,
+};
+
+// 51 bytes
+const Step_t Advance[] PROGMEM = {
+  SKIP_IF_NE(R1, 5),
+  JUMP(5),
+  CALL(GO_RIGHT),
+  JUMP(14),
+  SKIP_IF_NE(R0, 29),
+  JUMP(5),
+  CALL(NEXT_LINE),
+  JUMP(2),
+  CALL(NEXT_PAGE),
+  ADD_REG(R1, 1),
+  SKIP_IF_NE(R1, 6),
+  SET_REG(R1, 0),
+  ADD_REG(R0, 1),
+  SKIP_IF_NE(R0, 30),
+  SET_REG(R0, 0),
+  RET,
+};
+
+// 5 bytes
+const Step_t GoRight[] PROGMEM = {
+  MOVE(POS_RIGHT, 25),
+  WAIT(50),
+  RET,
+};
+
+// 13 bytes
+const Step_t NextLine[] PROGMEM = {
+  MOVE(POS_RIGHT, 25),
+  WAIT(50),
+  MOVE(POS_RIGHT, 25),
+  WAIT(50),
+  MOVE(POS_DOWN, 25),
+  WAIT(50),
+  RET,
+};
+
+// 23 bytes
+const Step_t NextPage[] PROGMEM = {
+  MARK(2),
+  MOVE(POS_RIGHT, 25),
+  WAIT(50),
+  MOVE(POS_RIGHT, 25),
+  WAIT(50),
+  LOOP(3),
+  MOVE(POS_DOWN, 25),
+  WAIT(50),
+  NEXT,
+  PRESS(SWITCH_R),
+  WAIT(200),
+  RET,
+};
+
+const Step_t* const Routines[] PROGMEM = {
+  [MAIN] = Main,
+  [SYNC] = SyncController,
+  [DELETE_POKEMON] = DeletePokemon,
+  [ADVANCE] = Advance,
+  [GO_RIGHT] = GoRight,
+  [NEXT_LINE] = NextLine,
+  [NEXT_PAGE] = NextPage,
+};
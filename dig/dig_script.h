@@ -0,0 +1,25 @@
+/*
+  Generated by mac2c.py from dig.mac. Do not edit; edit the .mac file and
+  run "python mac2c.py dig.mac" again.
+*/
+
+enum {
+  MAIN,
+  SYNC,
+};
+
+// 11 bytes
+const Step_t Main[] PROGMEM = {
+  CALL(SYNC),
+  FOREVER,
+  MARK(1),
+  PRESS(SWITCH_A),
+  WAIT(50),
+  NEXT,
+  END,
+};
+
+const Step_t* const Routines[] PROGMEM = {
+  [MAIN] = Main,
+  [SYNC] = SyncController,
+};
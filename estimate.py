@@ -0,0 +1,272 @@
+#!/bin/python
+
+# Predicts how long a script takes, from its compiled program alone: no
+# firmware, no simulated polls. Step durations are added up along the
+# program's control flow, and reported per routine call, per loop iteration,
+# per phase (from a mark to the next one) and per cycle (from one mark 1 to
+# the next).
+#
+#   estimate.py [-p poll_ms] [-k tick_ms] yourScript.mac
+#
+# A step lasts its duration in ticks, but at least one poll: the engine shows
+# every step to the host at least once. A script that loops forever is
+# followed until a forever loop comes back to where it started, registers
+# included; that stretch is its period. Natives run C code the estimate can't
+# follow: they count as taking no time, and are listed.
+
+import sys, os, re, getopt
+
+import mac2c
+
+# Durations of the steps macros used by routines written in C.
+C_STEPS = {
+  'PRESS': None, 'BUTTON_A': None, 'BUTTON_B': None, 'BUTTON_X': None,
+  'BUTTON_R': None, 'BUTTON_GAP': 50, 'BUTTON_RIGHT': 25, 'BUTTON_LEFT': 25,
+  'BUTTON_DOWN': 25, 'BUTTON_UP': 25,
+}
+
+class EstimateError(Exception):
+  pass
+
+# Reads the steps of a routine written in C, such as SyncController, from the
+# sources next to the script or to mac2c.py.
+def c_routine(symbol, source):
+  dirs = [os.path.dirname(os.path.abspath(source)), os.path.dirname(os.path.abspath(__file__))]
+  for d in dirs:
+    for name in sorted(os.listdir(d)):
+      if not name.endswith('.c'):
+        continue
+      text = open(os.path.join(d, name)).read()
+      m = re.search(r'\b%s\s*\[\s*\]\s*PROGMEM\s*=\s*\{(.*?)\};' % re.escape(symbol), text, re.S)
+      if m:
+        return c_steps(symbol, m.group(1))
+  raise EstimateError('routine %s not found in C sources' % symbol)
+
+def c_steps(symbol, body):
+  body = re.sub(r'//.*', '', body)
+  code = []
+  for m in re.finditer(r'(\w+)\s*(\(([^()]*)\))?', body):
+    name, args = m.group(1), m.group(3)
+    if name in ('RET', 'END'):
+      code.append(mac2c.Op(name, [], 0))
+    elif name in C_STEPS:
+      d = C_STEPS[name]
+      code.append(mac2c.Step(0, 128, 128, mac2c.CONSTANTS['BUTTON_DURATION'] if d is None else d, 0))
+    elif name in ('WAIT', 'MOVE', 'STEP', 'STEP_BUTTONS', 'STEP_STICK'):
+      d = args.split(',')[-1].strip()
+      d = mac2c.CONSTANTS.get(d, d)
+      code.append(mac2c.Step(0, 128, 128, int(d), 0))
+    else:
+      raise EstimateError('%s: cannot estimate %s' % (symbol, name))
+  return code
+
+# Min, max, mean and count of a list of durations.
+class Stats(object):
+  def __init__(self):
+    self.times = []
+
+  def add(self, ms):
+    self.times.append(ms)
+
+  def row(self, name):
+    t = self.times
+    return '%-24s %6d %10.3f %10.3f %10.3f' % (name, len(t), min(t) / 1000.0, max(t) / 1000.0,
+                                               float(sum(t)) / len(t) / 1000.0)
+
+class Estimator(object):
+  def __init__(self, routines, poll, tick):
+    self.routines = routines
+    self.poll, self.tick = poll, tick
+    self.offsets = []
+    for r in routines:
+      at, offsets = 0, {}
+      for i, item in enumerate(r.code):
+        offsets[at] = i
+        at += item.length()
+      offsets[at] = len(r.code)
+      self.offsets.append(offsets)
+    self.calls = {}
+    self.loops = {}
+    self.loop_order = []
+    self.marks = []
+    self.natives = {}
+    self.time = 0
+    self.period = None
+
+  def step_time(self, step):
+    ms = step.duration * self.tick
+    return max(ms, self.poll) if ms else 0
+
+  # Index of the instruction after the NEXT closing the loop opened at `i`.
+  def after_loop(self, code, i):
+    depth = 0
+    for j in range(i + 1, len(code)):
+      if isinstance(code[j], mac2c.Op):
+        if code[j].name in ('LOOP', 'LOOP_REG', 'FOREVER'):
+          depth += 1
+        elif code[j].name == 'NEXT':
+          if depth == 0:
+            return j + 1
+          depth -= 1
+    raise EstimateError('unclosed loop')
+
+  def loop_stats(self, routine, op):
+    key = (routine.name, op.line, op.c())
+    if key not in self.loops:
+      self.loops[key] = Stats()
+      self.loop_order.append(key)
+    return self.loops[key]
+
+  def run(self):
+    regs = [0] * 4
+    reg = lambda arg: int(str(arg)[1:]) % 4
+    # Frames: ('call', routine, return index, start) and
+    # ['loop', routine, body index, count left, iteration start, op,
+    #  registers seen at the start of each iteration of a forever loop,
+    #  iterations]
+    stack = []
+    r = 0
+    i = 0
+    while True:
+      routine = self.routines[r]
+      code = routine.code
+      item = code[i]
+      if isinstance(item, mac2c.Step):
+        self.time += self.step_time(item)
+        i += 1
+        continue
+      name, args = item.name, item.args
+      i += 1
+      if name == 'END':
+        break
+      elif name == 'CALL':
+        target = [x.enum() for x in self.routines].index(args[0])
+        stack.append(('call', r, i, self.time))
+        r, i = target, 0
+      elif name == 'RET':
+        if not stack:
+          break
+        frame = stack.pop()
+        callee = self.routines[r].name
+        self.calls.setdefault(callee, Stats()).add(self.time - frame[3])
+        r, i = frame[1], frame[2]
+      elif name in ('LOOP', 'LOOP_REG', 'FOREVER'):
+        count = {'LOOP': lambda: args[0], 'LOOP_REG': lambda: regs[reg(args[0])],
+                 'FOREVER': lambda: 0}[name]()
+        if name != 'FOREVER' and count == 0:
+          i = self.after_loop(code, i - 1)
+        else:
+          self.loop_stats(routine, item)
+          seen = {tuple(regs): (self.time, 0)} if name == 'FOREVER' else None
+          stack.append(['loop', r, i, count, self.time, item, seen, 0])
+      elif name == 'NEXT':
+        frame = stack[-1]
+        self.loop_stats(self.routines[frame[1]], frame[5]).add(self.time - frame[4])
+        frame[4] = self.time
+        frame[7] += 1
+        if frame[5].name == 'FOREVER':
+          state = tuple(regs)
+          if state in frame[6]:
+            start, iteration = frame[6][state]
+            self.period = (self.routines[frame[1]].name, frame[5].line,
+                           frame[7] - iteration, start, self.time - start)
+            break
+          frame[6][state] = (self.time, frame[7])
+          i = frame[2]
+        else:
+          frame[3] -= 1
+          if frame[3] > 0:
+            i = frame[2]
+          else:
+            stack.pop()
+      elif name == 'SET_REG':
+        regs[reg(args[0])] = args[1]
+      elif name == 'ADD_REG':
+        regs[reg(args[0])] = (regs[reg(args[0])] + args[1]) & 0xFFFF
+      elif name in ('SKIP_IF_EQ', 'SKIP_IF_NE'):
+        if (regs[reg(args[0])] == args[1]) == (name == 'SKIP_IF_EQ'):
+          i += 1
+      elif name == 'JUMP':
+        at = sum(x.length() for x in code[:i])
+        i = self.offsets[r][at + args[0]]
+      elif name == 'MARK':
+        self.marks.append((self.time, args[0]))
+      elif name == 'NATIVE':
+        self.natives[item.target] = self.natives.get(item.target, 0) + 1
+
+  def report(self, out):
+    out.append('%-24s %6s %10s %10s %10s' % ('', 'count', 'min s', 'max s', 'mean s'))
+    for r in self.routines[1:]:
+      if r.name in self.calls:
+        out.append(self.calls[r.name].row('routine ' + r.name))
+    for key in self.loop_order:
+      routine, line, op = key
+      out.append(self.loops[key].row('%s:%d %s' % (routine, line, op.lower().replace('_reg', ''))))
+    # A script running forever is measured over one period, wrapping around
+    marks = self.marks
+    wrap = []
+    if self.period:
+      start, length = self.period[3:]
+      marks = [(t, m) for t, m in marks if t >= start]
+      wrap = [(t + length, m) for t, m in marks]
+    phases = {}
+    for (t, mark), (following, _) in zip(marks, (marks + wrap)[1:]):
+      phases.setdefault(mark, Stats()).add(following - t)
+    for mark in sorted(phases):
+      out.append(phases[mark].row('mark %d' % mark))
+    starts = [t for t, mark in marks if mark == 1]
+    starts += [t for t, mark in wrap if mark == 1][:1]
+    if len(starts) > 1:
+      cycles = Stats()
+      for a, b in zip(starts, starts[1:]):
+        cycles.add(b - a)
+      out.append(cycles.row('cycle'))
+    if self.period:
+      out.append('runs forever, repeating every %d iterations of the forever loop at %s:%d: %.3f s' %
+                 (self.period[2], self.period[0], self.period[1], self.period[4] / 1000.0))
+    else:
+      out.append('ends after %.3f s' % (self.time / 1000.0))
+    for name in sorted(self.natives):
+      out.append('not counting native %s, run %d times' % (name, self.natives[name]))
+
+def main(argv):
+  opts, args = getopt.getopt(argv, "hp:k:")
+  poll, tick = 8, 8
+  for opt, arg in opts:
+    if opt == '-h':
+      usage()
+      sys.exit()
+    elif opt == '-p':
+      poll = int(arg)
+    elif opt == '-k':
+      tick = int(arg)
+  if len(args) != 1:
+    usage()
+    sys.exit(1)
+
+  source = args[0]
+  try:
+    routines = mac2c.link(mac2c.parse(open(source).read()))
+    for r in routines:
+      if r.extern:
+        r.code = c_routine(r.extern, source)
+    estimator = Estimator(routines, poll, tick)
+    estimator.run()
+  except (mac2c.CompileError, EstimateError) as e:
+    print("{}: {}".format(source, e))
+    sys.exit(1)
+
+  out = ['{}: {} ms ticks, {} ms polls'.format(source, tick, poll)]
+  estimator.report(out)
+  print('\n'.join(out))
+
+def usage():
+  print("To estimate how long a script takes: estimate.py yourScript.mac")
+  print("At another poll interval or tick length: estimate.py -p 5 -k 8 yourScript.mac")
+
+if __name__ == "__main__":
+  if len(sys.argv[1:]) == 0:
+    usage()
+    sys.exit
+  else:
+    main(sys.argv[1:])
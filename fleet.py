@@ -0,0 +1,292 @@
+#!/bin/python
+
+# Keeps a fleet of boards running the streaming firmware (stream/, see
+# stream.py) busy from one process: each board plays its trace over and over
+# on its own serial port, and how far every board and the fleet have got is
+# printed every -i seconds (60 by default) and at the end.
+#
+#   fleet.py [-b baud] [-k frames] [-i seconds] [-t seconds] [-f file] board ...
+#
+# A board is "device=trace[:unit[:mark]]": its serial port, the trace it
+# plays, and what it makes, counted once per "mark <mark>" in the trace, or
+# once per pass without a mark:
+#
+#   $ python fleet.py /dev/ttyUSB0=hatch.trace:eggs:1 /dev/ttyUSB1=release.trace:boxes:2
+#
+# -f reads more boards from a file, one to a line. Each trace is coded once,
+# as stream.py codes it, for every board playing it; a board is sent whole
+# frames, up to LEAD_S seconds ahead of what it plays, running on into the
+# next pass, so that it never stops in between and ends soon after it's
+# told to. The ports all run from one epoll loop, at -b baud: a board's
+# stream starts on its XON, which it sends every second between streams, or
+# after XON_WAIT seconds without one, and the kernel then minds its XOFF and
+# XON. A board whose port goes away is opened again every RETRY_S
+# seconds. Progress is counted by time: a board plays its trace in real time
+# from the start of its stream, as long as it's kept fed, and no faster than
+# it was sent. -t stops after that many seconds rather than on Ctrl-C; either
+# way each board is sent the end of the stream, to finish what it has and
+# let go of the controls.
+#
+# "make fleet", in host/, runs it against host builds of the firmware
+# standing in for boards on pseudo-terminals.
+
+import sys, os, getopt, errno, select, signal, time, bisect, termios, tty
+import stream
+
+XON_WAIT = 2.0
+RETRY_S = 5.0
+LEAD_S = 3.0
+TICK_S = 0.1
+CHUNK = 256
+
+class FleetError(Exception):
+  pass
+
+# A trace, coded once for all the boards playing it: one pass of frames,
+# where each frame ends, in bytes and in ms, and when each mark comes.
+class Job:
+  def __init__(self, path, keyframe):
+    self.path = path
+    lines = open(path).readlines()
+    held = stream.reports(lines)
+    out = stream.frames(held, keyframe)[:-1]
+    self.frames = [f for _, f in out]
+    self.data = bytearray().join(self.frames)
+    self.ms = sum(ms for _, ms in held)
+    self.byte_ends, length = [], 0
+    for _, f in out:
+      length += len(f)
+      self.byte_ends.append(length)
+    self.ms_ends = [at for at, _ in out[1:]] + [self.ms]
+    self.marks = {}
+    for f in (line.split() for line in lines):
+      if len(f) == 3 and f[1] == 'mark' and int(f[0]) < self.ms:
+        self.marks.setdefault(int(f[2]), []).append(int(f[0]))
+
+  # The units made in `ms` of playing: passes, or marks with this id.
+  def units(self, ms, mark):
+    if mark is None:
+      return ms // self.ms
+    marks = self.marks.get(mark, [])
+    return ms // self.ms * len(marks) + bisect.bisect_right(marks, ms % self.ms)
+
+  # How far `sent` bytes of passes over and over play, in ms.
+  def sent_ms(self, sent):
+    passes, rest = divmod(sent, len(self.data))
+    i = bisect.bisect_right(self.byte_ends, rest)
+    return passes * self.ms + (self.ms_ends[i - 1] if i else 0)
+
+class Board:
+  def __init__(self, spec, jobs, keyframe):
+    try:
+      self.device, what = spec.split('=', 1)
+    except ValueError:
+      raise FleetError('%s: a board is device=trace[:unit[:mark]]' % spec)
+    what = what.split(':')
+    if what[0] not in jobs:
+      jobs[what[0]] = Job(what[0], keyframe)
+    self.job = jobs[what[0]]
+    self.unit = what[1] if len(what) > 1 else 'passes'
+    self.mark = int(what[2]) if len(what) > 2 else None
+    if self.mark is not None and self.mark not in self.job.marks:
+      raise FleetError('%s: the trace has no mark %d' % (spec, self.mark))
+    self.fd = None
+    self.state = 'gone'
+    self.retry_at = 0
+    # Units made in the streams before this one, bytes sent in all, and this
+    # stream's progress.
+    self.made = 0
+    self.total = 0
+    self.started = None
+    self.sent = 0
+    self.next = 0
+    self.pending = bytearray()
+
+  def open(self, loop, baud, now):
+    self.retry_at = now + RETRY_S
+    try:
+      self.fd = os.open(self.device, os.O_RDWR | os.O_NOCTTY | os.O_NONBLOCK)
+      tty.setraw(self.fd)
+      attrs = termios.tcgetattr(self.fd)
+      attrs[4] = attrs[5] = getattr(termios, 'B%d' % baud)
+      termios.tcsetattr(self.fd, termios.TCSANOW, attrs)
+      termios.tcflush(self.fd, termios.TCIOFLUSH)
+    except (OSError, termios.error):
+      if self.fd is not None:
+        os.close(self.fd)
+      self.fd = None
+      return
+    self.state, self.xon_by = 'waiting', now + XON_WAIT
+    loop.register(self.fd, select.EPOLLIN)
+
+  # Starts the stream, with the kernel minding XON and XOFF from now on.
+  def start(self, loop, now):
+    attrs = termios.tcgetattr(self.fd)
+    attrs[0] |= termios.IXON
+    termios.tcsetattr(self.fd, termios.TCSANOW, attrs)
+    self.state, self.started, self.sent = 'streaming', now, 0
+    self.next, self.pending = 0, bytearray()
+
+  # How far ahead of the board's playing the frames sent are, in ms.
+  def lead(self, now):
+    return self.job.sent_ms(self.sent) - (now - self.started) * 1000
+
+  # Writes what the port takes of the frame being sent, then whole frames
+  # while the board is less than LEAD_S ahead; waits for the port to take
+  # more only while a frame is part sent.
+  def write(self, loop, now):
+    while self.pending or self.lead(now) < LEAD_S * 1000:
+      if not self.pending:
+        self.pending = bytearray(self.job.frames[self.next])
+        self.next = (self.next + 1) % len(self.job.frames)
+      try:
+        n = os.write(self.fd, bytes(self.pending[:CHUNK]))
+      except OSError as e:
+        if e.errno == errno.EAGAIN:
+          break
+        raise
+      del self.pending[:n]
+      self.sent += n
+      self.total += n
+    loop.modify(self.fd, select.EPOLLIN | (select.EPOLLOUT if self.pending else 0))
+
+  # Reads what the board sends: its XON, before the stream, and otherwise
+  # nothing the fleet needs.
+  def read(self, loop, now):
+    try:
+      data = bytearray(os.read(self.fd, CHUNK))
+    except OSError as e:
+      if e.errno == errno.EAGAIN:
+        return
+      raise
+    if not data:
+      raise OSError(errno.EIO, 'port closed')
+    if self.state == 'waiting' and stream.XON in data:
+      self.start(loop, now)
+
+  def playing(self, now):
+    if self.started is None:
+      return 0
+    return self.job.units(int(min((now - self.started) * 1000, self.job.sent_ms(self.sent))), self.mark)
+
+  def drop(self, loop, now):
+    self.made += self.playing(now)
+    self.started = None
+    loop.unregister(self.fd)
+    os.close(self.fd)
+    self.fd, self.state = None, 'gone'
+
+  # Ends the stream after the frame being sent, and lets go of the port. The
+  # board takes the end within LEAD_S, unless it's gone.
+  def finish(self, loop, now):
+    if self.state == 'streaming':
+      data = self.pending + stream.frame([stream.FRAME_END])
+      until = now + LEAD_S + 1
+      try:
+        while data and select.select([], [self.fd], [], max(until - time.time(), 0))[1]:
+          del data[:os.write(self.fd, bytes(data[:CHUNK]))]
+      except OSError:
+        pass
+      if data:
+        print('%s: could not send the end of the stream' % self.device)
+    if self.fd is not None:
+      self.drop(loop, now)
+      self.state = 'stopped'
+
+  def units(self, now):
+    return self.made + self.playing(now)
+
+def status(boards, begun, now):
+  hours = max(now - begun, 1e-9) / 3600
+  print('fleet: %d s' % (now - begun))
+  print('  %-20s %-20s %-10s %10s %10s %-8s %9s' % ('board', 'trace', 'state', 'sent KB', 'made', '', '/h'))
+  totals = {}
+  for b in boards:
+    made = b.units(now)
+    print('  %-20s %-20s %-10s %10d %10d %-8s %9.1f' % (
+      b.device, os.path.basename(b.job.path), b.state, b.total // 1024, made, b.unit, made / hours))
+    totals[b.unit] = totals.get(b.unit, 0) + made
+  for unit in sorted(totals):
+    print('  %-20s %-20s %-10s %10s %10d %-8s %9.1f' % ('fleet', '', '', '', totals[unit], unit, totals[unit] / hours))
+  sys.stdout.flush()
+
+def run(boards, baud, interval, limit):
+  loop = select.epoll()
+  stopping = []
+  signal.signal(signal.SIGINT, lambda *_: stopping.append(True))
+  signal.signal(signal.SIGTERM, lambda *_: stopping.append(True))
+  begun = time.time()
+  report_at = begun + interval
+  while not stopping:
+    now = time.time()
+    if limit and now - begun >= limit:
+      break
+    if now >= report_at:
+      status(boards, begun, now)
+      report_at += interval
+    for b in boards:
+      if b.state == 'gone' and now >= b.retry_at:
+        b.open(loop, baud, now)
+      elif b.state == 'waiting' and now >= b.xon_by:
+        b.start(loop, now)
+
+    try:
+      events = loop.poll(min(TICK_S, max(0.0, report_at - now)))
+    except IOError as e:
+      if e.errno != errno.EINTR:
+        raise
+      events = []
+    now = time.time()
+    events = dict(events)
+    for b in boards:
+      if b.fd is None:
+        continue
+      event = events.get(b.fd, 0)
+      try:
+        if event & (select.EPOLLERR | select.EPOLLHUP):
+          raise OSError(errno.EIO, 'hung up')
+        if event & select.EPOLLIN:
+          b.read(loop, now)
+        if b.state == 'streaming':
+          b.write(loop, now)
+      except OSError as e:
+        print('%s: %s, opening it again in %d s' % (b.device, os.strerror(e.errno), RETRY_S))
+        b.drop(loop, now)
+
+  now = time.time()
+  for b in boards:
+    b.finish(loop, now)
+  status(boards, begun, now)
+
+def main(argv):
+  opts, args = getopt.getopt(argv, "hb:k:i:t:f:")
+  baud, keyframe, interval, limit = 115200, 50, 60, None
+  for opt, arg in opts:
+    if opt == '-h':
+      usage()
+      sys.exit()
+    elif opt == '-b':
+      baud = int(arg)
+    elif opt == '-k':
+      keyframe = int(arg)
+    elif opt == '-i':
+      interval = float(arg)
+    elif opt == '-t':
+      limit = float(arg)
+    elif opt == '-f':
+      args += [line.strip() for line in open(arg) if line.strip() and not line.startswith('#')]
+  if not args or not hasattr(termios, 'B%d' % baud):
+    usage()
+    sys.exit(1)
+
+  jobs = {}
+  boards = [Board(spec, jobs, keyframe) for spec in args]
+  run(boards, baud, interval, limit)
+
+def usage():
+  print("To keep boards busy: fleet.py /dev/ttyUSB0=hatch.trace:eggs:1 /dev/ttyUSB1=release.trace:boxes:2")
+  print("With the boards in a file: fleet.py -f boards.txt")
+  print("Reporting every 10 s, for an hour: fleet.py -i 10 -t 3600 -f boards.txt")
+
+if __name__ == "__main__":
+  main(sys.argv[1:])
@@ -0,0 +1,449 @@
+/** \file
+ *
+ *  Host build of the firmware. Stands in for LUFA's USB stack and the AVR's
+ *  Timer 0, runs the firmware's own main loop against a simulated host that
+ *  polls the joystick every few milliseconds of virtual time, and prints the
+ *  reports the host receives, one line per change:
+ *
+ *        ms button hat  lx  ly  rx  ry
+ *
+ *  with a line for each MARK the script runs, "<ms>  mark <id>", and one for
+ *  the time the run stopped, "<ms> end". Usage:
+ *
+ *    build/<script> [-p poll_ms] [-t limit_ms] [-a] [-e eeprom] [-d ms] [-m id]
+ *                   [-u file | -U file | -P link]
+ *
+ *  -p sets the poll interval (default 8 ms), -t how long to run (default
+ *  60000 ms), and -a prints every report instead of only the changes. -e
+ *  keeps the EEPROM in a file: read at the start if it's there, written at
+ *  the end, so that a run goes on from where the last one was stopped. -d
+ *  unplugs the joystick at that time and plugs it back in UNPLUGGED_MS
+ *  later, noting both with comment lines ("# ..."). -m stops the run at the
+ *  first "mark <id>" instead, such as the one a script runs when it's done.
+ *  -u plays a PC sending the file to the UART, at the baud rate the firmware
+ *  set, starting on its XON and stopping UART_XOFF_LAG bytes after its XOFF.
+ *  -U sends it in chunks at set times instead: each is the time to send it
+ *  at, in ms after the XON (4 bytes, low byte first), its length (a byte),
+ *  and its bytes. Lines of text the firmware sends to the UART are printed
+ *  as comments, "# <ms> uart: <text>". -P stands in for a board wired to a
+ *  PC instead, for fleet.py and the like: the UART is a pseudo-terminal,
+ *  whose other end is linked at `link`, and virtual time keeps to real time.
+ *  With -u, a firmware built with SCRIPT_UPLOAD takes a script from the file
+ *  (../upload.py -o), its pages of flash written by HostFlash().
+ */
+
+// For posix_openpt() and cfmakeraw().
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../Engine.h"
+
+// How long the joystick stays unplugged with -d, in ms.
+#define UNPLUGGED_MS 1000
+
+// Bytes the PC still sends with -u once told XOFF, as a USB serial adapter's
+// FIFO would, and the flow control bytes.
+#define UART_XOFF_LAG 32
+#define XON  0x11
+#define XOFF 0x13
+
+// The firmware's main(), renamed by the makefile.
+int Firmware_Main(void);
+// Timer 0's compare match interrupt, from Engine.c.
+void TIMER0_COMPA_vect(void);
+
+volatile uint8_t MCUSR;
+volatile uint8_t DDRB, PORTB, DDRD, PORTD;
+volatile uint8_t TCCR0A, TCCR0B, OCR0A, TIMSK0, TCNT0, TIFR0;
+volatile uint8_t UCSR1A, UCSR1B, UCSR1C, UDR1;
+volatile uint16_t UBRR1;
+volatile uint8_t USB_DeviceState = DEVICE_STATE_Unattached;
+
+static uint32_t PollInterval = 8;
+static uint32_t TimeLimit = 60000;
+static bool AllReports = false;
+static const char* EepromFile = NULL;
+static uint32_t UnplugAt = 0;
+static uint8_t StopMark = 0;
+static FILE* UartFile = NULL;
+static bool UartTimed = false;
+static int UartPty = -1;
+
+// The firmware's UART interrupts, if it has them.
+void USART1_RX_vect(void) __attribute__((weak));
+void USART1_UDRE_vect(void) __attribute__((weak));
+
+// The PC's end of the UART: whether it's stopped, the bytes it still sends
+// if so, the bits it could have sent since its last byte and that the
+// firmware could have, times 1000, and the line of text it's receiving.
+static bool UartStopped = true;
+static uint8_t UartLag = 0;
+static uint32_t UartBits = 0;
+static uint32_t UartTxBits = 0;
+static char UartLine[128];
+static size_t UartLineLength = 0;
+
+// With -U: whether the first XON came and when, when the chunk being sent
+// was due, and its bytes left to send.
+static bool UartStarted = false;
+static uint32_t UartStart;
+static uint32_t UartChunkAt;
+static int UartChunkLeft = 0;
+
+// UartByte() when the PC has nothing to send yet.
+#define UART_IDLE (-2)
+
+// With -P, when the run started, in real time.
+static struct timespec RealStart;
+
+// The firmware's EEPROM variables, if it has any.
+extern uint8_t __start_eeprom_host[] __attribute__((weak));
+extern uint8_t __stop_eeprom_host[] __attribute__((weak));
+
+// The selected endpoint, and when the host polls the IN endpoint next.
+static uint8_t SelectedEndpoint;
+static uint32_t NextPoll = 0;
+
+// The report being written to the IN endpoint, and the last one printed.
+static USB_JoystickReport_Input_t InReport;
+static USB_JoystickReport_Input_t PrintedReport;
+static bool Printed = false;
+
+// Erases the EEPROM, then reads it from EepromFile if there's one.
+static void LoadEeprom(void) {
+	FILE* f;
+
+	memset(__start_eeprom_host, 0xFF, __stop_eeprom_host - __start_eeprom_host);
+	if (EepromFile && (f = fopen(EepromFile, "rb")))
+	{
+		if (fread(__start_eeprom_host, 1, __stop_eeprom_host - __start_eeprom_host, f)) {}
+		fclose(f);
+	}
+}
+
+static void SaveEeprom(void) {
+	FILE* f;
+
+	if (!EepromFile)
+		return;
+	if (!(f = fopen(EepromFile, "wb")))
+	{
+		perror(EepromFile);
+		exit(2);
+	}
+	fwrite(__start_eeprom_host, 1, __stop_eeprom_host - __start_eeprom_host, f);
+	fclose(f);
+}
+
+// Stops the run, printing when.
+static void Finish(void) {
+	printf("%8lu end\n", (unsigned long)Milliseconds);
+	SaveEeprom();
+	exit(0);
+}
+
+// Called by the engine on every MARK.
+void HostMark(uint8_t id) {
+	printf("%8lu  mark %u\n", (unsigned long)Milliseconds, id);
+	if (id == StopMark)
+		Finish();
+}
+
+// Called by the script loader (../Upload.c) to write a page of flash, which
+// is ordinary memory here.
+void HostFlash(const uint8_t* page, const uint8_t* data) {
+	memcpy((uint8_t*)page, data, SPM_PAGESIZE);
+}
+
+void USB_Init(void) {
+	USB_DeviceState = DEVICE_STATE_Configured;
+	EVENT_USB_Device_Connect();
+	EVENT_USB_Device_ConfigurationChanged();
+}
+
+// The next byte the PC sends, UART_IDLE if it's waiting to send it, or EOF
+// once it's sent them all.
+static int UartByte(void) {
+	uint8_t header[5];
+	uint8_t c;
+
+	if (UartPty >= 0)
+		return read(UartPty, &c, 1) == 1 ? c : UART_IDLE;
+	if (!UartTimed)
+		return fgetc(UartFile);
+	if (!UartChunkLeft)
+	{
+		if (fread(header, 1, sizeof(header), UartFile) != sizeof(header))
+			return EOF;
+		UartChunkAt = header[0] | header[1] << 8 | (uint32_t)header[2] << 16 | (uint32_t)header[3] << 24;
+		UartChunkLeft = header[4];
+	}
+	if ((int32_t)(Milliseconds - UartStart - UartChunkAt) < 0)
+		return UART_IDLE;
+	UartChunkLeft--;
+	return fgetc(UartFile);
+}
+
+// The PC gets a byte from the firmware.
+static void UartReceive(uint8_t c) {
+	if (c == XON && UartStopped)
+	{
+		if (!UartStarted)
+			UartStart = Milliseconds;
+		UartStarted = true;
+		UartStopped = false;
+	}
+	else if (c == XOFF && !UartStopped)
+	{
+		UartStopped = true;
+		UartLag = UART_XOFF_LAG;
+	}
+	else if (c == '\n')
+	{
+		printf("# %6lu uart: %.*s\n", (unsigned long)Milliseconds, (int)UartLineLength, UartLine);
+		UartLineLength = 0;
+	}
+	else if (c != '\r' && UartLineLength < sizeof(UartLine))
+	{
+		UartLine[UartLineLength++] = c;
+	}
+}
+
+// Runs the UART for a millisecond: the firmware and the PC each send as many
+// bytes as the baud rate lets them, 10 bits each, the PC from its file or
+// from the pseudo-terminal.
+static void UartTick(void) {
+	uint32_t baud = F_CPU / ((UCSR1A & (1 << U2X1)) ? 8 : 16) / (UBRR1 + 1);
+	uint8_t sent;
+	int c;
+
+	if (!USART1_RX_vect || !(UCSR1B & (1 << RXEN1)) || !(UCSR1B & (1 << RXCIE1)))
+		return;
+	for (UartTxBits += baud; UartTxBits >= 10000 && (UCSR1B & (1 << UDRIE1)); UartTxBits -= 10000)
+	{
+		// The firmware never sends 0, so a 0 left means it sent nothing
+		UDR1 = 0;
+		USART1_UDRE_vect();
+		if (UDR1 && UartPty >= 0)
+		{
+			sent = UDR1;
+			if (write(UartPty, &sent, 1) != 1) {}
+		}
+		if (UDR1)
+			UartReceive(UDR1);
+	}
+	if (!(UCSR1B & (1 << UDRIE1)))
+		UartTxBits = 0;
+
+	if (!UartFile && UartPty < 0)
+		return;
+	for (UartBits += baud; UartBits >= 10000; UartBits -= 10000)
+	{
+		if (UartStopped && !UartLag)
+			continue;
+		if ((c = UartByte()) == UART_IDLE)
+		{
+			UartBits = 0;
+			return;
+		}
+		if (c == EOF)
+		{
+			fclose(UartFile);
+			UartFile = NULL;
+			return;
+		}
+		if (UartStopped)
+			UartLag--;
+		UDR1 = c;
+		USART1_RX_vect();
+	}
+}
+
+// With -P, waits until real time catches up with virtual time.
+static void KeepRealTime(void) {
+	struct timespec now, wait;
+	int64_t ahead;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	ahead = (int64_t)Milliseconds * 1000000
+		- ((int64_t)(now.tv_sec - RealStart.tv_sec) * 1000000000 + (now.tv_nsec - RealStart.tv_nsec));
+	if (ahead <= 0)
+		return;
+	wait.tv_sec = ahead / 1000000000;
+	wait.tv_nsec = ahead % 1000000000;
+	nanosleep(&wait, NULL);
+}
+
+// Lets a millisecond of virtual time pass, unplugging the joystick and
+// plugging it back in when -d says so.
+static void Tick(void) {
+	if (Milliseconds >= TimeLimit)
+		Finish();
+	if (UartPty >= 0)
+		KeepRealTime();
+	TIMER0_COMPA_vect();
+	UartTick();
+	if (UnplugAt && Milliseconds == UnplugAt)
+	{
+		printf("# %6lu unplugged\n", (unsigned long)Milliseconds);
+		USB_DeviceState = DEVICE_STATE_Unattached;
+		EVENT_USB_Device_Disconnect();
+	}
+	else if (UnplugAt && Milliseconds == UnplugAt + UNPLUGGED_MS)
+	{
+		printf("# %6lu plugged in\n", (unsigned long)Milliseconds);
+		NextPoll = Milliseconds;
+		USB_Init();
+	}
+}
+
+// Runs once per main loop iteration: lets virtual time pass, one timer
+// interrupt per millisecond, until the host polls again. While unplugged, a
+// millisecond passes per iteration.
+void USB_USBTask(void) {
+	if (USB_DeviceState != DEVICE_STATE_Configured)
+		Tick();
+	else
+		while ((int32_t)(Milliseconds - NextPoll) < 0)
+			Tick();
+	if (Milliseconds >= TimeLimit)
+		Finish();
+}
+
+bool Endpoint_ConfigureEndpoint(const uint8_t Address, const uint8_t Type, const uint16_t Size, const uint8_t Banks) {
+	return true;
+}
+
+void Endpoint_SelectEndpoint(const uint8_t Address) {
+	SelectedEndpoint = Address;
+}
+
+// The host never sends anything to the joystick.
+bool Endpoint_IsOUTReceived(void) {
+	return false;
+}
+
+bool Endpoint_IsINReady(void) {
+	return SelectedEndpoint == JOYSTICK_IN_EPADDR && (int32_t)(Milliseconds - NextPoll) >= 0;
+}
+
+bool Endpoint_IsReadWriteAllowed(void) {
+	return false;
+}
+
+void Endpoint_ClearOUT(void) {
+}
+
+uint8_t Endpoint_Read_Stream_LE(void* const Buffer, uint16_t Length, uint16_t* const BytesProcessed) {
+	return ENDPOINT_RWSTREAM_NoError;
+}
+
+uint8_t Endpoint_Write_Stream_LE(const void* const Buffer, uint16_t Length, uint16_t* const BytesProcessed) {
+	if (Length > sizeof(InReport))
+		Length = sizeof(InReport);
+	memcpy(&InReport, Buffer, Length);
+	return ENDPOINT_RWSTREAM_NoError;
+}
+
+// The host receives the report written, and polls again after PollInterval.
+void Endpoint_ClearIN(void) {
+	if (AllReports || !Printed || memcmp(&InReport, &PrintedReport, sizeof(InReport)))
+	{
+		printf("%8lu  %04x  %x %3u %3u %3u %3u\n", (unsigned long)Milliseconds,
+			InReport.Button, InReport.HAT, InReport.LX, InReport.LY, InReport.RX, InReport.RY);
+		memcpy(&PrintedReport, &InReport, sizeof(InReport));
+		Printed = true;
+	}
+	NextPoll += PollInterval;
+}
+
+static void Usage(const char* name) {
+	fprintf(stderr, "usage: %s [-p poll_ms] [-t limit_ms] [-a] [-e eeprom] [-d ms] [-m id] [-u file | -U file | -P link]\n", name);
+	exit(2);
+}
+
+// Opens a pseudo-terminal for the UART and links its other end at `link`,
+// set raw and held open, so that the PC can come and go.
+static void OpenPty(const char* link) {
+	struct termios raw;
+	const char* name;
+	int other;
+
+	if ((UartPty = posix_openpt(O_RDWR | O_NOCTTY)) < 0 || grantpt(UartPty) || unlockpt(UartPty)
+		|| !(name = ptsname(UartPty)) || (other = open(name, O_RDWR | O_NOCTTY)) < 0)
+	{
+		perror("pseudo-terminal");
+		exit(2);
+	}
+	tcgetattr(other, &raw);
+	cfmakeraw(&raw);
+	tcsetattr(other, TCSANOW, &raw);
+	fcntl(UartPty, F_SETFL, O_NONBLOCK);
+	if ((unlink(link) && errno != ENOENT) || symlink(name, link))
+	{
+		perror(link);
+		exit(2);
+	}
+	// The PC may come after the firmware's first XON, and takes no notice
+	// of the flow control but through the line, which stops
+	// UART_XOFF_LAG bytes after XOFF as with -u.
+	UartStopped = false;
+	clock_gettime(CLOCK_MONOTONIC, &RealStart);
+}
+
+int main(int argc, char* argv[]) {
+	int opt;
+
+	while ((opt = getopt(argc, argv, "p:t:ae:d:m:u:U:P:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'p':
+				PollInterval = strtoul(optarg, NULL, 10);
+				break;
+			case 't':
+				TimeLimit = strtoul(optarg, NULL, 10);
+				break;
+			case 'a':
+				AllReports = true;
+				break;
+			case 'e':
+				EepromFile = optarg;
+				break;
+			case 'd':
+				UnplugAt = strtoul(optarg, NULL, 10);
+				break;
+			case 'm':
+				StopMark = strtoul(optarg, NULL, 10);
+				break;
+			case 'U':
+				UartTimed = true;
+				/* fall through */
+			case 'u':
+				if (!(UartFile = fopen(optarg, "rb")))
+				{
+					perror(optarg);
+					exit(2);
+				}
+				break;
+			case 'P':
+				OpenPty(optarg);
+				break;
+			default:
+				Usage(argv[0]);
+		}
+	}
+	if (optind != argc || PollInterval == 0)
+		Usage(argv[0]);
+
+	LoadEeprom();
+	printf("#     ms button hat  lx  ly  rx  ry\n");
+	return Firmware_Main();
+}
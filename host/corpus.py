@@ -0,0 +1,266 @@
+#!/bin/python
+
+# Printer throughput over a corpus of images: each image is converted, planned
+# and printed by the host build with each of the printer's ways of going over
+# the canvas, from the first report after homing to the last report of the
+# print, and the counts are tabled:
+#
+#   reports    reports the console receives (one per poll)
+#   moves      D-pad presses
+#   A          A presses: pixels, or pen stamps, inked
+#   time       how long the print takes, in seconds
+#
+#   corpus.py [-c "cc cflags"] [-s strategies] [image.png|image.data ...]
+#
+# Without images, the corpus is ../splatoonpattern.png, ../ironic.data as it
+# is and inverted (the sample image.c), a dithered photo and line art, the
+# last two made up here: the kinds of images people print. .data images are
+# read as bin2c.py reads them, .png ones made bilevel as png2c.py makes them.
+# -s picks strategies from sweep, rehome (every REHOME_ROWS rows), plan and
+# pens (PENS), all by default. Images and programs are built under
+# build/corpus; run it with "make corpus".
+
+import sys, os, math, shutil, struct, subprocess, getopt, zlib
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(HERE)
+sys.path.insert(0, ROOT)
+import imagec
+
+WIDTH, HEIGHT = imagec.CANVAS_WIDTH, imagec.CANVAS_HEIGHT
+REHOME_ROWS = 16
+PENS = '1,3,7'
+PRINT_MARK, DONE_MARK = 1, 4
+SWITCH_A, HAT_CENTER = 0x04, 8
+POLL_MS = 8
+
+# Strategy: compiler flags, and plan.py options for the plan it needs, if any.
+STRATEGIES = [
+  ('sweep', [], None),
+  ('rehome', ['-DREHOME_ROWS=%d' % REHOME_ROWS], None),
+  ('plan', ['-DPRINT_PLAN'], ('plan.h', [])),
+  ('pens', ['-DPRINT_PLAN', '-DPRINT_PENS'], ('pens.h', ['-s', PENS])),
+]
+
+class CorpusError(Exception):
+  pass
+
+# Grey levels of a PNG, 0 to 255: PIL's if it's there, else the 8-bit
+# non-interlaced ones decoded here.
+def png_grey(path):
+  try:
+    from PIL import Image
+    im = Image.open(path).convert('L')
+    px = im.load()
+    return [[px[x, y] for x in range(im.size[0])] for y in range(im.size[1])]
+  except ImportError:
+    pass
+
+  data = open(path, 'rb').read()
+  at, idat, palette = 8, b'', None
+  while at < len(data):
+    length, kind = struct.unpack('>I4s', data[at:at + 8])
+    body = data[at + 8:at + 8 + length]
+    if kind == b'IHDR':
+      width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', body)
+    elif kind == b'PLTE':
+      palette = bytearray(body)
+    elif kind == b'IDAT':
+      idat += body
+    at += 12 + length
+  channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(color)
+  if depth != 8 or interlace or channels is None:
+    raise CorpusError('%s: only 8-bit non-interlaced PNGs can be read without PIL' % path)
+
+  raw = bytearray(zlib.decompress(idat))
+  stride = width * channels
+  rows, prior = [], bytearray(stride)
+  for y in range(height):
+    kind, line = raw[y * (stride + 1)], raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)]
+    for i in range(stride):
+      a = line[i - channels] if i >= channels else 0
+      b, c = prior[i], prior[i - channels] if i >= channels else 0
+      if kind == 1:
+        line[i] = (line[i] + a) & 0xff
+      elif kind == 2:
+        line[i] = (line[i] + b) & 0xff
+      elif kind == 3:
+        line[i] = (line[i] + (a + b) // 2) & 0xff
+      elif kind == 4:
+        p = a + b - c
+        pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+        line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xff
+    prior = line
+    if color == 3:
+      pixels = [palette[3 * v:3 * v + 3] for v in line]
+    elif color in (2, 6):
+      pixels = [line[x:x + 3] for x in range(0, stride, channels)]
+    else:
+      pixels = [line[x:x + 1] * 3 for x in range(0, stride, channels)]
+    # ITU-R 601-2 luma, as PIL's
+    rows.append([(r * 299 + g * 587 + b * 114) // 1000 for r, g, b in pixels])
+  return rows
+
+# Floyd-Steinberg dithers grey levels to 0/1 pixels, 1 to ink (black), as
+# PIL's convert('1') does for png2c.py.
+def dither(grey):
+  height, width = len(grey), len(grey[0])
+  level = [[float(v) for v in row] for row in grey]
+  rows = []
+  for y in range(height):
+    row = []
+    for x in range(width):
+      old = level[y][x]
+      new = 255.0 if old >= 128 else 0.0
+      error = old - new
+      row.append(0 if new else 1)
+      if x + 1 < width:
+        level[y][x + 1] += error * 7 / 16
+      if y + 1 < height:
+        if x > 0:
+          level[y + 1][x - 1] += error * 3 / 16
+        level[y + 1][x] += error * 5 / 16
+        if x + 1 < width:
+          level[y + 1][x + 1] += error * 1 / 16
+    rows.append(row)
+  return rows
+
+def read_data(path):
+  data = bytearray(open(path, 'rb').read())
+  return [[data[y * WIDTH + x] & 1 for x in range(WIDTH)] for y in range(len(data) // WIDTH)]
+
+# A photo stand-in: smooth shading over the whole canvas, a lit sphere in
+# front of it, dithered.
+def photo():
+  grey = []
+  for y in range(HEIGHT):
+    row = []
+    for x in range(WIDTH):
+      v = 140 + 50 * math.sin(x / 37.0) * math.cos(y / 23.0) - 40.0 * y / HEIGHT
+      if math.hypot(x - 210, y - 62) < 48:
+        v = 40 + 200 * max(0.0, 1 - math.hypot(x - 190, y - 45) / 60.0)
+      row.append(max(0, min(255, int(v))))
+    grey.append(row)
+  return dither(grey)
+
+# Line art: outlines of circles and boxes, and a few long strokes.
+def line_art():
+  rows = [[0] * WIDTH for _ in range(HEIGHT)]
+  def dot(x, y):
+    if 0 <= x < WIDTH and 0 <= y < HEIGHT:
+      rows[y][x] = 1
+  def line(x0, y0, x1, y1):
+    n = max(abs(x1 - x0), abs(y1 - y0))
+    for i in range(n + 1):
+      dot(x0 + (x1 - x0) * i // n, y0 + (y1 - y0) * i // n)
+  for cx, cy, r in [(60, 60, 45), (60, 60, 20), (250, 40, 30), (170, 90, 22)]:
+    for i in range(8 * r):
+      a = 2 * math.pi * i / (8 * r)
+      dot(int(round(cx + r * math.cos(a))), int(round(cy + r * math.sin(a))))
+  for x0, y0, x1, y1 in [(120, 10, 200, 10), (200, 10, 200, 60), (200, 60, 120, 60), (120, 60, 120, 10),
+                         (5, 115, 315, 100), (130, 110, 230, 20), (230, 80, 310, 115)]:
+    line(x0, y0, x1, y1)
+  return rows
+
+def corpus():
+  return [
+    ('splatoonpattern', dither(png_grey(os.path.join(ROOT, 'splatoonpattern.png')))),
+    ('ironic', read_data(os.path.join(ROOT, 'ironic.data'))),
+    ('ironic-inverted', [[v ^ 1 for v in row] for row in read_data(os.path.join(ROOT, 'ironic.data'))]),
+    ('photo', photo()),
+    ('lineart', line_art()),
+  ]
+
+def load(path):
+  name = os.path.splitext(os.path.basename(path))[0]
+  if path.endswith('.png'):
+    return name, dither(png_grey(path))
+  return name, read_data(path)
+
+def run(command, **kw):
+  p = subprocess.Popen(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, **kw)
+  out = p.communicate()[0].decode()
+  if p.returncode:
+    raise CorpusError('%s failed:\n%s' % (' '.join(command), out))
+  return out
+
+# Lays out a copy of the printer's sources around the image in `d`, as they
+# are in the repository, so that its "../image.h" is this image's.
+def tree(d, name, rows):
+  if os.path.isdir(d):
+    shutil.rmtree(d)
+  os.makedirs(os.path.join(d, 'printer'))
+  for f in os.listdir(ROOT):
+    if f.endswith('.h') and f != 'image.h':
+      shutil.copy(os.path.join(ROOT, f), d)
+  for f in ['printer.c', 'printer.h', 'journal.c', 'journal.h', 'printer_script.h']:
+    shutil.copy(os.path.join(ROOT, 'printer', f), os.path.join(d, 'printer'))
+  imagec.write(rows, 0, 0, name, 'corpus.py', d)
+
+# Builds and runs the printer with one strategy, returning its counts.
+def measure(d, strategy, cc):
+  label, flags, plan = strategy
+  if plan:
+    run([sys.executable, os.path.join(ROOT, 'plan.py')] + plan[1] +
+        ['-o', os.path.join(d, 'printer', plan[0]), os.path.join(d, 'image.c')])
+  program = os.path.join(d, label)
+  run(cc.split() + flags + ['-o', program] +
+      [os.path.join(d, 'printer', f) for f in ['printer.c', 'journal.c']] +
+      [os.path.join(d, 'image.c'), 'build/Engine.o', 'build/HostMain.o'], cwd=HERE)
+  trace = run([program, '-a', '-p', str(POLL_MS), '-t', '36000000', '-m', str(DONE_MARK)])
+
+  reports = moves = presses = 0
+  start = end = None
+  hat, button = HAT_CENTER, 0
+  for line in trace.splitlines():
+    f = line.split()
+    if len(f) == 3 and f[1] == 'mark':
+      if int(f[2]) == PRINT_MARK and start is None:
+        start = int(f[0])
+      elif int(f[2]) == DONE_MARK:
+        end = int(f[0])
+    elif len(f) == 7 and start is not None and end is None:
+      b, h = int(f[1], 16), int(f[2], 16)
+      reports += 1
+      moves += h != HAT_CENTER and h != hat
+      presses += b & SWITCH_A and not button & SWITCH_A
+      hat, button = h, b
+  if start is None or end is None:
+    raise CorpusError('%s: the print did not finish' % program)
+  return reports, moves, presses, (end - start) / 1000.0
+
+def main(argv):
+  opts, args = getopt.getopt(argv, "hc:s:")
+  cc = 'cc -std=gnu99 -O2 -Istub -DF_CPU=16000000UL -DMARK_HOOK=HostMark'
+  strategies = STRATEGIES
+  for opt, arg in opts:
+    if opt == '-h':
+      usage()
+      sys.exit()
+    elif opt == '-c':
+      cc = arg
+    elif opt == '-s':
+      wanted = arg.split(',')
+      strategies = [s for s in STRATEGIES if s[0] in wanted]
+      if len(strategies) != len(wanted):
+        usage()
+        sys.exit(1)
+
+  images = [load(path) for path in args] if args else corpus()
+  print('%-16s %-8s %9s %8s %8s %9s' % ('image', 'strategy', 'reports', 'moves', 'A', 'time s'))
+  for name, rows in images:
+    if len(rows[0]) != WIDTH or len(rows) != HEIGHT:
+      raise CorpusError('%s: images in the corpus fill the %dx%d canvas' % (name, WIDTH, HEIGHT))
+    d = os.path.join(HERE, 'build', 'corpus', name)
+    tree(d, name, rows)
+    for strategy in strategies:
+      print('%-16s %-8s %9d %8d %8d %9.1f' % ((name, strategy[0]) + measure(d, strategy, cc)))
+      sys.stdout.flush()
+
+def usage():
+  print('Printer throughput over the built-in corpus: corpus.py')
+  print('Over some images instead: corpus.py image.png other.data')
+  print('With some strategies: corpus.py -s sweep,plan')
+
+if __name__ == "__main__":
+  main(sys.argv[1:])
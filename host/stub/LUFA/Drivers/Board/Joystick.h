@@ -0,0 +1,6 @@
+// Host stand-in for LUFA's board Joystick driver, which the firmware doesn't use.
+
+#ifndef _HOST_LUFA_BOARD_JOYSTICK_H_
+#define _HOST_LUFA_BOARD_JOYSTICK_H_
+
+#endif
@@ -0,0 +1,6 @@
+// Host stand-in for LUFA's board LEDs driver, which the firmware doesn't use.
+
+#ifndef _HOST_LUFA_BOARD_LEDS_H_
+#define _HOST_LUFA_BOARD_LEDS_H_
+
+#endif
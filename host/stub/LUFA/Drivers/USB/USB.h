@@ -0,0 +1,90 @@
+// Host stand-in for LUFA's USB driver: the descriptor types Descriptors.h
+// needs, and the device and endpoint API the firmware calls, implemented by
+// HostMain.c as a simulated host polling the joystick.
+
+#ifndef _HOST_LUFA_USB_H_
+#define _HOST_LUFA_USB_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define ATTR_WARN_UNUSED_RESULT
+#define ATTR_NON_NULL_PTR_ARG(...)
+
+#define ENDPOINT_DIR_IN   0x80
+#define ENDPOINT_DIR_OUT  0x00
+#define EP_TYPE_INTERRUPT 0x03
+
+enum USB_Device_States_t {
+	DEVICE_STATE_Unattached = 0,
+	DEVICE_STATE_Powered    = 1,
+	DEVICE_STATE_Default    = 2,
+	DEVICE_STATE_Addressed  = 3,
+	DEVICE_STATE_Configured = 4,
+	DEVICE_STATE_Suspended  = 5,
+};
+
+enum Endpoint_Stream_RW_ErrorCodes_t {
+	ENDPOINT_RWSTREAM_NoError = 0,
+};
+
+typedef struct {
+	uint8_t Size;
+	uint8_t Type;
+} USB_Descriptor_Header_t;
+
+typedef struct {
+	USB_Descriptor_Header_t Header;
+	uint16_t TotalConfigurationSize;
+	uint8_t  TotalInterfaces;
+	uint8_t  ConfigurationNumber;
+	uint8_t  ConfigurationStrIndex;
+	uint8_t  ConfigAttributes;
+	uint8_t  MaxPowerConsumption;
+} USB_Descriptor_Configuration_Header_t;
+
+typedef struct {
+	USB_Descriptor_Header_t Header;
+	uint8_t InterfaceNumber;
+	uint8_t AlternateSetting;
+	uint8_t TotalEndpoints;
+	uint8_t Class;
+	uint8_t SubClass;
+	uint8_t Protocol;
+	uint8_t InterfaceStrIndex;
+} USB_Descriptor_Interface_t;
+
+typedef struct {
+	USB_Descriptor_Header_t Header;
+	uint16_t HIDSpec;
+	uint8_t  CountryCode;
+	uint8_t  TotalReportDescriptors;
+	uint8_t  HIDReportType;
+	uint16_t HIDReportLength;
+} USB_HID_Descriptor_HID_t;
+
+typedef struct {
+	USB_Descriptor_Header_t Header;
+	uint8_t  EndpointAddress;
+	uint8_t  Attributes;
+	uint16_t EndpointSize;
+	uint8_t  PollingIntervalMS;
+} USB_Descriptor_Endpoint_t;
+
+extern volatile uint8_t USB_DeviceState;
+
+void USB_Init(void);
+void USB_USBTask(void);
+
+bool Endpoint_ConfigureEndpoint(const uint8_t Address, const uint8_t Type, const uint16_t Size, const uint8_t Banks);
+void Endpoint_SelectEndpoint(const uint8_t Address);
+bool Endpoint_IsOUTReceived(void);
+bool Endpoint_IsINReady(void);
+bool Endpoint_IsReadWriteAllowed(void);
+void Endpoint_ClearOUT(void);
+void Endpoint_ClearIN(void);
+uint8_t Endpoint_Read_Stream_LE(void* const Buffer, uint16_t Length, uint16_t* const BytesProcessed);
+uint8_t Endpoint_Write_Stream_LE(const void* const Buffer, uint16_t Length, uint16_t* const BytesProcessed);
+
+#endif
@@ -0,0 +1,9 @@
+// Host stand-in for LUFA's platform header.
+
+#ifndef _HOST_LUFA_PLATFORM_H_
+#define _HOST_LUFA_PLATFORM_H_
+
+#define GlobalInterruptEnable()  ((void)0)
+#define GlobalInterruptDisable() ((void)0)
+
+#endif
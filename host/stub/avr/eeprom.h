@@ -0,0 +1,33 @@
+// Host stand-in for <avr/eeprom.h>. EEPROM variables are ordinary memory in
+// a section of their own, which HostMain.c erases to 0xFF, and loads and
+// saves with -e; writes are done at once.
+
+#ifndef _HOST_AVR_EEPROM_H_
+#define _HOST_AVR_EEPROM_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#define EEMEM __attribute__((section("eeprom_host")))
+
+static inline int eeprom_is_ready(void) {
+	return 1;
+}
+
+static inline uint8_t eeprom_read_byte(const uint8_t* at) {
+	return *at;
+}
+
+static inline void eeprom_read_block(void* to, const void* at, size_t length) {
+	memcpy(to, at, length);
+}
+
+static inline void eeprom_update_byte(uint8_t* at, uint8_t value) {
+	*at = value;
+}
+
+static inline void eeprom_update_block(const void* from, void* at, size_t length) {
+	memcpy(at, from, length);
+}
+
+#endif
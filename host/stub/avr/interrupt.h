@@ -0,0 +1,11 @@
+// Host stand-in for <avr/interrupt.h>. An ISR is a plain function, which
+// HostMain.c calls to simulate the interrupt.
+
+#ifndef _HOST_AVR_INTERRUPT_H_
+#define _HOST_AVR_INTERRUPT_H_
+
+#define ISR(vector) void vector(void)
+#define sei() ((void)0)
+#define cli() ((void)0)
+
+#endif
@@ -0,0 +1,32 @@
+// Host stand-in for <avr/io.h>: the registers the firmware touches, as plain
+// variables defined by HostMain.c.
+
+#ifndef _HOST_AVR_IO_H_
+#define _HOST_AVR_IO_H_
+
+#include <stdint.h>
+
+extern volatile uint8_t MCUSR;
+extern volatile uint8_t DDRB, PORTB, DDRD, PORTD;
+extern volatile uint8_t TCCR0A, TCCR0B, OCR0A, TIMSK0, TCNT0, TIFR0;
+extern volatile uint8_t UCSR1A, UCSR1B, UCSR1C, UDR1;
+extern volatile uint16_t UBRR1;
+
+#define WDRF   3
+#define WGM01  1
+#define CS00   0
+#define CS01   1
+#define OCIE0A 1
+#define OCF0A  1
+#define U2X1   1
+#define UCSZ10 1
+#define UCSZ11 2
+#define TXEN1  3
+#define RXEN1  4
+#define UDRIE1 5
+#define RXCIE1 7
+
+// The AT90USB1286's flash page, in bytes.
+#define SPM_PAGESIZE 256
+
+#endif
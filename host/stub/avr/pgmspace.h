@@ -0,0 +1,37 @@
+// Host stand-in for <avr/pgmspace.h>. Flash is ordinary memory here; the host
+// is assumed little-endian, like the AVR.
+
+#ifndef _HOST_AVR_PGMSPACE_H_
+#define _HOST_AVR_PGMSPACE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(s) (s)
+
+static inline uint8_t pgm_read_byte(const void* at) {
+	return *(const uint8_t*)at;
+}
+
+static inline uint16_t pgm_read_word(const void* at) {
+	uint16_t word;
+	memcpy(&word, at, sizeof(word));
+	return word;
+}
+
+static inline uint32_t pgm_read_dword(const void* at) {
+	uint32_t dword;
+	memcpy(&dword, at, sizeof(dword));
+	return dword;
+}
+
+static inline void* pgm_read_ptr(const void* at) {
+	void* ptr;
+	memcpy(&ptr, at, sizeof(ptr));
+	return ptr;
+}
+
+#define memcpy_P memcpy
+
+#endif
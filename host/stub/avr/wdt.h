@@ -0,0 +1,8 @@
+// Host stand-in for <avr/wdt.h>.
+
+#ifndef _HOST_AVR_WDT_H_
+#define _HOST_AVR_WDT_H_
+
+#define wdt_disable() ((void)0)
+
+#endif
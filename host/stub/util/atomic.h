@@ -0,0 +1,11 @@
+// Host stand-in for <util/atomic.h>. Interrupts are simulated between main
+// loop iterations, so every block is atomic already.
+
+#ifndef _HOST_UTIL_ATOMIC_H_
+#define _HOST_UTIL_ATOMIC_H_
+
+#define ATOMIC_RESTORESTATE 0
+#define ATOMIC_FORCEON      1
+#define ATOMIC_BLOCK(type) for (int _atomic_done = 0; !_atomic_done; _atomic_done = 1)
+
+#endif
@@ -0,0 +1,30 @@
+// Host stand-in for <util/crc16.h>: avr-libc's CRC updates, as the C
+// equivalents its documentation gives for them.
+
+#ifndef _HOST_UTIL_CRC16_H_
+#define _HOST_UTIL_CRC16_H_
+
+#include <stdint.h>
+
+// CRC-8 with the polynomial x^8 + x^2 + x + 1, 0 to start with.
+static inline uint8_t _crc8_ccitt_update(uint8_t crc, uint8_t data) {
+	uint8_t i;
+
+	crc ^= data;
+	for (i = 0; i < 8; i++)
+		crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+	return crc;
+}
+
+// CRC-16 with the polynomial x^16 + x^12 + x^5 + 1, high bit first, from
+// whatever value the caller starts with.
+static inline uint16_t _crc_xmodem_update(uint16_t crc, uint8_t data) {
+	uint8_t i;
+
+	crc ^= (uint16_t)data << 8;
+	for (i = 0; i < 8; i++)
+		crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+	return crc;
+}
+
+#endif
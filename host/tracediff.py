@@ -0,0 +1,142 @@
+#!/bin/python
+
+# Compares two report traces printed by the host build: whether the game sees
+# the same sequence of reports, where the first difference is, in which phase
+# of the script, and how long each phase and cycle takes in both.
+#
+#   tracediff.py golden/dig.trace build/dig.trace
+#
+# Phases are the script's marks; the time from mark 1 to the next mark 1 is a
+# cycle. How many times each phase runs in the new trace, and for how long in
+# all, shows what a phase that's an overhead costs, such as the printer's
+# homing its cursor again (mark 2). Exits with 1 if the traces differ in any
+# way, 0 otherwise.
+
+import sys, getopt
+
+class Trace:
+  def __init__(self, path):
+    self.path = path
+    self.reports = []                     # (ms, (button, hat, lx, ly, rx, ry))
+    self.marks = []                       # (ms, id)
+    self.end = None
+    with open(path) as f:
+      for lineno, line in enumerate(f, 1):
+        fields = line.split()
+        if not fields or fields[0].startswith('#'):
+          continue
+        try:
+          ms = int(fields[0])
+          if fields[1:2] == ['mark'] and len(fields) == 3:
+            self.marks.append((ms, int(fields[2])))
+          elif fields[1:] == ['end']:
+            self.end = ms
+          elif len(fields) == 7:
+            self.reports.append((ms, tuple(fields[1:])))
+          else:
+            raise ValueError
+        except ValueError:
+          raise SystemExit('%s:%d: bad trace line' % (path, lineno))
+
+  # Where `ms` falls in the script: the last mark at or before it.
+  def phase(self, ms):
+    last = None
+    count = {}
+    for t, mark in self.marks:
+      if t > ms:
+        break
+      count[mark] = count.get(mark, 0) + 1
+      last = (t, mark)
+    if last is None:
+      return 'before the first mark'
+    return 'mark %d #%d, +%d ms' % (last[1], count[last[1]], ms - last[0])
+
+  # Lengths of each cycle, and of each phase: from a mark to the next one.
+  def lengths(self):
+    phases = {}
+    for (t, mark), (following, _) in zip(self.marks, self.marks[1:]):
+      phases.setdefault(mark, []).append(following - t)
+    starts = [t for t, mark in self.marks if mark == 1]
+    cycles = [b - a for a, b in zip(starts, starts[1:])]
+    if cycles:
+      phases['cycle'] = cycles
+    return phases
+
+def report_text(report):
+  return ' '.join(report)
+
+def compare(old, new):
+  same = True
+  print('old: %s, %d reports, %d marks, ends at %s ms' % (old.path, len(old.reports), len(old.marks), old.end))
+  print('new: %s, %d reports, %d marks, ends at %s ms' % (new.path, len(new.reports), len(new.marks), new.end))
+
+  # The input sequence, regardless of timing, as far as both traces go.
+  for i, ((to, ro), (tn, rn)) in enumerate(zip(old.reports, new.reports)):
+    if ro != rn:
+      print('input: differs at report %d:' % (i + 1))
+      print('  old %s at %d ms, in %s' % (report_text(ro), to, old.phase(to)))
+      print('  new %s at %d ms, in %s' % (report_text(rn), tn, new.phase(tn)))
+      same = False
+      break
+  else:
+    print('input: same sequence for the first %d reports' % min(len(old.reports), len(new.reports)))
+    if len(old.reports) != len(new.reports):
+      same = False
+
+  # The timing of the reports both traces agree on.
+  for i, ((to, ro), (tn, rn)) in enumerate(zip(old.reports, new.reports)):
+    if ro != rn:
+      break
+    if to != tn:
+      print('timing: first differs at report %d: %d ms -> %d ms (%+d ms), in %s' %
+            (i + 1, to, tn, tn - to, old.phase(to)))
+      same = False
+      break
+  else:
+    print('timing: same')
+  if [m for _, m in old.marks] != [m for _, m in new.marks]:
+    print('marks: different sequence')
+    same = False
+  if old.end != new.end:
+    print('end: %s ms -> %s ms' % (old.end, new.end))
+    same = False
+  if old.marks != new.marks:
+    same = False
+
+  # Phase and cycle lengths: their mean, and how many there are and how long
+  # they take in all in the new trace, for phases that are an overhead.
+  lo = old.lengths()
+  ln = new.lengths()
+  mean = lambda v: float(sum(v)) / len(v) if v else None
+  keys = sorted([k for k in set(lo) | set(ln) if k != 'cycle'])
+  if 'cycle' in lo or 'cycle' in ln:
+    keys.append('cycle')
+  if keys:
+    print('%-10s %12s %12s %12s %6s %12s' % ('phase', 'old ms', 'new ms', 'delta ms', 'count', 'total ms'))
+  for k in keys:
+    name = k if k == 'cycle' else 'mark %d' % k
+    o = mean(lo.get(k))
+    n = mean(ln.get(k))
+    delta = '%+.1f' % (n - o) if o is not None and n is not None else '-'
+    print('%-10s %12s %12s %12s %6d %12d' % (name,
+                                   '%.1f' % o if o is not None else '-',
+                                   '%.1f' % n if n is not None else '-', delta,
+                                   len(ln.get(k, [])), sum(ln.get(k, []))))
+  return same
+
+def main(argv):
+  opts, args = getopt.getopt(argv, "h")
+  for opt, arg in opts:
+    if opt == '-h':
+      usage()
+      sys.exit()
+  if len(args) != 2:
+    usage()
+    sys.exit(2)
+  sys.exit(0 if compare(Trace(args[0]), Trace(args[1])) else 1)
+
+def usage():
+  print("To compare a trace with a golden one: tracediff.py <old.trace> <new.trace>")
+
+if __name__ == "__main__":
+  main(sys.argv[1:])
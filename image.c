@@ -1,4 +1,130 @@
-#include <stdint.h>
-#include <avr/pgmspace.h>
+#include "image.h"
 
-const uint8_t image_data[0x12c1] PROGMEM = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x80, 0x58, 0xd0, 0xda, 0x6a, 0x5d, 0xbb, 0xff, 0x6f, 0xff, 0xef, 0xb7, 0xdd, 0x2d, 0xbd, 0xfb, 0xbf, 0x7d, 0xfb, 0xbe, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x20, 0x24, 0x55, 0xb7, 0xef, 0xfe, 0xfd, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xdf, 0xdb, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x10, 0x48, 0xaa, 0xde, 0xfe, 0xb7, 0x6f, 0xff, 0xf7, 0x7d, 0xff, 0x76, 0xfb, 0xee, 0xd7, 0xff, 0xef, 0xdf, 0xf7, 0x7f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x28, 0x20, 0xdd, 0xfa, 0xdd, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfb, 0xfd, 0x57, 0xbf, 0xfd, 0x7f, 0xfb, 0xff, 0xbf, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x20, 0x90, 0x72, 0x6b, 0xef, 0xee, 0xfe, 0xff, 0x7e, 0xf7, 0xef, 0x6f, 0xbb, 0xfd, 0xff, 0xed, 0xff, 0xfe, 0xfe, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x10, 0x48, 0xad, 0xdd, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xfd, 0xfe, 0xfe, 0x6b, 0xdb, 0xff, 0xdf, 0xf7, 0xf7, 0xbf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x20, 0x80, 0xd4, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xb7, 0xdf, 0xff, 0xff, 0xfb, 0xbf, 0xbf, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x0, 0x4, 0xa9, 0xa5, 0xef, 0xdb, 0xfe, 0xbd, 0xf7, 0xfb, 0xbb, 0xbf, 0xfd, 0x76, 0xed, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x20, 0x8, 0x52, 0xdd, 0x7e, 0xff, 0xff, 0xff, 0xbf, 0xdf, 0xff, 0xfd, 0xef, 0xbd, 0xfb, 0xbf, 0xb7, 0xfb, 0xfd, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x0, 0x48, 0x92, 0xfe, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0x6f, 0xdf, 0xf7, 0xd7, 0xfb, 0xff, 0xff, 0x6f, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6, 0x0, 0x0, 0x10, 0xb4, 0xa9, 0x6f, 0xf7, 0xef, 0xff, 0xff, 0xfb, 0xb7, 0xff, 0x7b, 0xaf, 0x7e, 0xff, 0xfb, 0xdf, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x0, 0x20, 0x24, 0x69, 0x77, 0xff, 0xfe, 0xff, 0xdd, 0xfd, 0xfe, 0xff, 0xfb, 0xff, 0x7d, 0xfb, 0xdf, 0x6f, 0xff, 0xbe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x0, 0x0, 0x0, 0xea, 0xde, 0xed, 0xbb, 0xff, 0xff, 0xdf, 0xdf, 0xfe, 0xdf, 0xfe, 0xef, 0xf7, 0x7f, 0xff, 0xfb, 0x77, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6, 0x0, 0x0, 0x8, 0xd5, 0xed, 0x5e, 0xf7, 0xfd, 0xff, 0xff, 0xf7, 0x77, 0xff, 0xb7, 0x7f, 0xdf, 0xfe, 0xfb, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x1, 0x40, 0x48, 0xba, 0x56, 0xbb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfd, 0xfd, 0xf7, 0xdf, 0xdf, 0xbf, 0xfd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xb4, 0x6, 0x0, 0x10, 0x6d, 0xab, 0xb5, 0x7a, 0xdf, 0xff, 0xff, 0xaf, 0xfd, 0x6f, 0xdf, 0xb7, 0xff, 0x7f, 0xff, 0xfb, 0x7d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x69, 0xd, 0x0, 0xb0, 0xf6, 0xdd, 0x6e, 0xb7, 0xfb, 0xdd, 0xf6, 0xfe, 0xbf, 0xff, 0xfb, 0xff, 0xdf, 0xff, 0xfb, 0xff, 0xef, 0x7e, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x4a, 0x59, 0x40, 0x48, 0xad, 0xb2, 0xf6, 0xed, 0xff, 0xff, 0xff, 0xdf, 0xfe, 0xfd, 0x7f, 0xfb, 0xfd, 0xff, 0x6f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xb6, 0xab, 0x80, 0xb0, 0xb6, 0xa7, 0x6d, 0x57, 0xdd, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdf, 0xbd, 0xed, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x49, 0x36, 0x1, 0xea, 0xdd, 0x4a, 0xbd, 0xbf, 0xfb, 0xff, 0xff, 0x7f, 0xef, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x7, 0xe, 0x6, 0x1e, 0xf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x24, 0x6d, 0x5, 0x6d, 0xdb, 0x5d, 0xeb, 0xed, 0xee, 0xfe, 0xdf, 0xdb, 0x7d, 0xff, 0xdf, 0xfe, 0x7d, 0xff, 0xff, 0xfd, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe7, 0xe4, 0xe4, 0x3c, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1, 0xd2, 0x2, 0xf4, 0xaf, 0xb3, 0xda, 0xff, 0xfd, 0xdf, 0xfe, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0x7b, 0xbb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe7, 0xe7, 0xe4, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x2, 0x6c, 0x3, 0xda, 0xde, 0xd6, 0xed, 0x6e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xf7, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe7, 0xe7, 0xe4, 0x3c, 0xe7, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1, 0xd9, 0xc6, 0xfd, 0xdd, 0xbb, 0xb7, 0xff, 0xbb, 0xfd, 0xf7, 0xbf, 0xed, 0xff, 0xed, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xe4, 0xf, 0xe6, 0x1c, 0xe, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x0, 0xa5, 0x8d, 0xf7, 0xbf, 0xb6, 0x7e, 0xdd, 0x7e, 0xff, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0xef, 0xff, 0xf7, 0xbb, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x6e, 0x61, 0xdf, 0x7b, 0xff, 0xed, 0xf6, 0xd7, 0xdf, 0xff, 0xff, 0x7f, 0xff, 0xbf, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x6d, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3, 0xb9, 0xeb, 0xfd, 0xdf, 0xbf, 0xff, 0x6f, 0xef, 0xfe, 0xfd, 0xbf, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x7f, 0x7b, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xdf, 0xd2, 0xff, 0x7f, 0xf5, 0xb7, 0xdf, 0xfa, 0xfe, 0xbf, 0xff, 0xf7, 0xbf, 0xfb, 0xfb, 0xff, 0xfd, 0xef, 0xef, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x6d, 0xb9, 0xbf, 0xfd, 0xff, 0xef, 0xbd, 0x6d, 0xfb, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0xda, 0xf4, 0xf7, 0xef, 0xda, 0x7e, 0x7f, 0xdf, 0xb7, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xb7, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xee, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0xb7, 0xda, 0xff, 0x7f, 0xf7, 0xe9, 0xf7, 0xdb, 0xfe, 0xf7, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0x7f, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x33, 0xfa, 0xff, 0xff, 0xab, 0xd7, 0xee, 0xb5, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0x7f, 0xfb, 0x7f, 0xff, 0xf7, 0xbf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0x3f, 0xfd, 0xfd, 0xbd, 0x5d, 0xbe, 0xbd, 0xdf, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xdb, 0xff, 0x7e, 0xfb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x9f, 0xee, 0xbf, 0xff, 0xf6, 0xea, 0xdb, 0xfb, 0x7b, 0x7f, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0x9a, 0xfd, 0xff, 0xef, 0xab, 0x55, 0xff, 0xb7, 0xff, 0xef, 0xef, 0xff, 0x7f, 0xfb, 0xdf, 0xfd, 0xff, 0xff, 0xdf, 0xb7, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x94, 0x7f, 0xff, 0xff, 0x2d, 0xfb, 0xf6, 0x6f, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xbf, 0xff, 0xfb, 0x7f, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x88, 0xf6, 0xef, 0xf6, 0xdb, 0xd6, 0xdf, 0xfd, 0xed, 0xff, 0xff, 0xff, 0xef, 0xff, 0xfd, 0xef, 0xff, 0xfb, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x62, 0xff, 0xff, 0x5f, 0x57, 0x29, 0xfd, 0xdf, 0xfe, 0xfe, 0x7f, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xf7, 0xbf, 0xff, 0xbd, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xc0, 0xff, 0xff, 0xbf, 0x9f, 0xf6, 0x6a, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xbf, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xc0, 0xee, 0xff, 0xff, 0xfe, 0xca, 0xbf, 0xeb, 0xed, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xbf, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x60, 0xff, 0xee, 0x76, 0xfb, 0xbd, 0xed, 0xb7, 0xff, 0xbf, 0xff, 0xff, 0x7f, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0x7f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff, 0xff, 0xed, 0x77, 0x35, 0xdf, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xd0, 0xfe, 0xff, 0xdf, 0xdf, 0xee, 0xdb, 0x7a, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xef, 0xbb, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x68, 0xf7, 0x7f, 0x7b, 0xbb, 0x5f, 0xf7, 0xed, 0xbf, 0xfb, 0x7f, 0xbf, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xfd, 0xbf, 0xff, 0xff, 0xe7, 0xc, 0xfe, 0xf, 0xe, 0xe6, 0x3c, 0xf, 0xfc, 0xf, 0xe, 0xe4, 0xc, 0xfe, 0xff, 0x1f, 0xf0, 0xff, 0xff, 0xef, 0xf6, 0xfd, 0xae, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xed, 0xff, 0xde, 0xff, 0xff, 0xff, 0x7, 0xe4, 0xfc, 0xe7, 0xe4, 0xe4, 0x3c, 0xe7, 0xfc, 0xc7, 0xe7, 0xe4, 0xe4, 0xfc, 0xff, 0xf, 0xa8, 0xff, 0xfe, 0xb7, 0xad, 0xb5, 0x7b, 0xfb, 0xf6, 0xff, 0xef, 0xff, 0xff, 0x7f, 0x7f, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xe7, 0x4, 0xfc, 0xe7, 0xe7, 0xe4, 0x3c, 0xe7, 0xfc, 0xf, 0xe6, 0x4c, 0x6, 0xfc, 0xff, 0x1f, 0x74, 0xff, 0xdf, 0x5f, 0xdb, 0xee, 0xdf, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xef, 0xff, 0xff, 0xff, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xe7, 0xe4, 0xff, 0xe7, 0xe7, 0xe4, 0x3c, 0xe7, 0xfc, 0x7f, 0xe4, 0x1c, 0xe7, 0xff, 0xff, 0xf, 0xe8, 0xfb, 0xff, 0xaf, 0x6a, 0x7f, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xe7, 0xc, 0xfe, 0xf, 0xc, 0xe, 0x1c, 0xe, 0xfc, 0x7, 0xe, 0xbc, 0xf, 0xfe, 0xff, 0xf, 0x48, 0xdf, 0xff, 0x7f, 0xb5, 0xd9, 0x6d, 0xbb, 0xfd, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xed, 0xf7, 0xbb, 0xef, 0xfe, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xb4, 0xff, 0xfb, 0xbf, 0xaa, 0xbb, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xe0, 0xfd, 0x7f, 0x7f, 0x49, 0xed, 0xb6, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xc0, 0xb6, 0xff, 0xbf, 0xb5, 0x76, 0x6f, 0xdb, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xdb, 0xdf, 0xff, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xa4, 0x7f, 0xed, 0x77, 0x4a, 0xed, 0xfd, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x68, 0xef, 0xfb, 0xff, 0x92, 0xaa, 0xdb, 0xee, 0xff, 0xff, 0x7f, 0xf7, 0xff, 0xff, 0xfb, 0xff, 0xed, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xd4, 0xfe, 0xb6, 0xbf, 0xb5, 0x54, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xd4, 0xfb, 0xef, 0x5d, 0xa3, 0x75, 0xbd, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0xff, 0xdf, 0xff, 0x7f, 0x7f, 0xf7, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf, 0x6, 0x6, 0xe, 0x6, 0xe, 0xfe, 0x9f, 0x7, 0xe, 0x46, 0xfe, 0xff, 0xff, 0x7, 0xa8, 0xbe, 0xef, 0xef, 0x16, 0xad, 0xdb, 0xf6, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xe7, 0x9c, 0xe7, 0xe4, 0xe4, 0xc4, 0xff, 0xf, 0xe6, 0xe4, 0x4, 0xfc, 0xff, 0xff, 0xf, 0x58, 0xbf, 0xb6, 0xbf, 0x6d, 0x52, 0xed, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x9c, 0xe7, 0x4, 0xe4, 0xf, 0xfe, 0x9f, 0xe7, 0xe7, 0xa4, 0xfc, 0xff, 0xff, 0xf, 0xf0, 0x56, 0xff, 0xf6, 0xcb, 0xb4, 0x76, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x9c, 0xe4, 0xe4, 0xe7, 0x7f, 0xfc, 0x9f, 0xe7, 0xe7, 0xe4, 0xfc, 0xff, 0xff, 0x1f, 0x0, 0xa8, 0xdd, 0x6f, 0x9f, 0xca, 0xed, 0xfe, 0xfb, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xef, 0xff, 0xdf, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xf, 0x3e, 0xe6, 0xc, 0xe6, 0x7, 0xfe, 0x9f, 0xe7, 0xf, 0xe6, 0xfc, 0xff, 0xff, 0xf, 0x0, 0x90, 0xfb, 0xbe, 0x75, 0x55, 0xdb, 0xef, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x8, 0x48, 0xef, 0xfb, 0xfb, 0xaa, 0xb6, 0xbd, 0xef, 0xff, 0xff, 0xfd, 0xb7, 0xfb, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0xa8, 0xb6, 0xb7, 0xcf, 0x55, 0xed, 0xf6, 0x7e, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xbe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x40, 0x7d, 0x7f, 0xbb, 0xaf, 0xda, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0xd0, 0xee, 0xed, 0x7f, 0x2d, 0xdb, 0xfe, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x88, 0xba, 0xbf, 0xd5, 0x76, 0xb5, 0xb5, 0xff, 0xef, 0xff, 0xff, 0xef, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x10, 0xf5, 0xf6, 0xbf, 0x5d, 0xda, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x52, 0x6e, 0x7f, 0xdb, 0xba, 0x75, 0xfb, 0xef, 0xfe, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x7f, 0xe4, 0xe0, 0xc0, 0xf1, 0xe0, 0x60, 0xe0, 0xe0, 0x7f, 0xe0, 0xe0, 0x60, 0xe0, 0xe0, 0xff, 0xff, 0x1f, 0x0, 0xa4, 0xda, 0xeb, 0xbf, 0x75, 0xed, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xde, 0x7f, 0x40, 0x4e, 0xce, 0x73, 0x4e, 0x4e, 0x4e, 0xce, 0x7f, 0x4e, 0x4e, 0xfc, 0x79, 0xfc, 0xff, 0xff, 0x1f, 0x0, 0x4a, 0xed, 0xde, 0xb6, 0xcd, 0xaa, 0xfe, 0xfb, 0xff, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x4a, 0x40, 0xce, 0x73, 0x4e, 0x7e, 0x7e, 0xc0, 0x7f, 0x4e, 0xce, 0xe0, 0xf9, 0xe0, 0xff, 0xff, 0x1f, 0x0, 0x54, 0xbb, 0xf7, 0x6d, 0x55, 0x75, 0xbb, 0x7f, 0xf7, 0xdf, 0xfb, 0xff, 0xee, 0xef, 0xff, 0xff, 0xef, 0xf7, 0xff, 0xff, 0xff, 0x7f, 0x4e, 0x7e, 0xce, 0x73, 0x4e, 0x7e, 0x7e, 0xfe, 0x7f, 0x4e, 0xce, 0xc7, 0xc9, 0xc7, 0xf3, 0xff, 0x3f, 0x0, 0xa8, 0x76, 0x7b, 0xbf, 0x6a, 0xdb, 0xf7, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x57, 0x7f, 0xce, 0xe0, 0xc0, 0xe1, 0xe0, 0x40, 0xfe, 0xe0, 0x7f, 0xe0, 0x60, 0xe0, 0x63, 0xe0, 0xf3, 0xff, 0x3f, 0x0, 0xe2, 0xdd, 0xff, 0xdf, 0xd5, 0x6a, 0x7f, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x3f, 0x0, 0x48, 0xff, 0xb6, 0xfb, 0x4b, 0xb7, 0xed, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x0, 0xfa, 0xea, 0xff, 0xff, 0xb7, 0xec, 0xfb, 0xfe, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x0, 0xe9, 0xff, 0xff, 0xff, 0xa5, 0xdd, 0xde, 0xef, 0xff, 0xef, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x0, 0x56, 0xbf, 0xfd, 0xff, 0xaf, 0xba, 0xf7, 0xfd, 0xff, 0xfd, 0x7d, 0xdf, 0xfe, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x40, 0xfe, 0xea, 0xff, 0xdf, 0x56, 0xf7, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0xf3, 0xff, 0xff, 0xff, 0xf1, 0xe3, 0xff, 0x7f, 0x80, 0xff, 0xff, 0xff, 0xfb, 0xad, 0xaa, 0x6f, 0xef, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xc9, 0xff, 0x7f, 0x80, 0x3d, 0xfd, 0xff, 0xbf, 0xaf, 0x76, 0xfb, 0xfe, 0xff, 0xff, 0xef, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xdf, 0x7f, 0x60, 0x4e, 0xe0, 0x7f, 0xe0, 0x60, 0xe0, 0x7f, 0xe0, 0x71, 0xe4, 0xe0, 0xe0, 0xf3, 0xf9, 0xff, 0x7f, 0x80, 0x7e, 0xed, 0x77, 0x7f, 0x5b, 0xfd, 0xdd, 0x7f, 0xf7, 0x7f, 0xff, 0xff, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x4e, 0xce, 0xf9, 0x7f, 0x4e, 0xce, 0xf9, 0x7f, 0xce, 0x73, 0x40, 0x7c, 0xce, 0xf3, 0xe0, 0xff, 0xff, 0x40, 0xeb, 0xbb, 0xfd, 0xdb, 0xcd, 0xaa, 0xf7, 0xed, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0x4e, 0xce, 0xf9, 0x7f, 0x4e, 0xce, 0xf9, 0x7f, 0xce, 0x73, 0xca, 0x60, 0xc0, 0xf3, 0xf9, 0xff, 0xff, 0x0, 0x95, 0xde, 0xdf, 0xff, 0x97, 0x76, 0xbf, 0xff, 0xff, 0xff, 0xbf, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfd, 0xff, 0xf7, 0x7f, 0x4e, 0xce, 0xc9, 0x7f, 0x4e, 0xce, 0xc9, 0x7f, 0xce, 0x73, 0xce, 0x47, 0xfe, 0xf3, 0xf9, 0xf3, 0xff, 0x80, 0x58, 0x75, 0xbb, 0xb6, 0x6e, 0xed, 0xed, 0xff, 0xff, 0xfe, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0xe0, 0xc0, 0xe3, 0x7f, 0xce, 0xe0, 0xe3, 0x7f, 0xce, 0x61, 0x4e, 0xe0, 0xe0, 0xe1, 0xf9, 0xf3, 0xff, 0x0, 0xa0, 0xaa, 0xf5, 0xed, 0x95, 0xda, 0x7b, 0xed, 0xfb, 0xff, 0xf7, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xb5, 0x6d, 0xdf, 0x2e, 0x6d, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x41, 0x40, 0x69, 0xdb, 0x76, 0xdb, 0xf4, 0xf6, 0xfe, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xa0, 0x96, 0xb6, 0xbb, 0x97, 0xee, 0xfb, 0x77, 0xbf, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x6d, 0x6d, 0xef, 0x36, 0x59, 0x6f, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xfd, 0xf7, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x50, 0xa9, 0xb5, 0xdd, 0x6d, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xfb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xa0, 0x52, 0x6a, 0xbb, 0xdb, 0xb6, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x0, 0xd6, 0xd6, 0x76, 0x97, 0xf4, 0xef, 0xff, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x0, 0x29, 0xad, 0x6d, 0x6d, 0xab, 0xfd, 0xed, 0xff, 0xff, 0xff, 0x7f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x0, 0xd2, 0xda, 0xda, 0xbb, 0xde, 0xb6, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x80, 0x24, 0xb5, 0x6d, 0xdb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x0, 0xac, 0x65, 0xb7, 0xb6, 0x55, 0xed, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x0, 0xd9, 0xde, 0xda, 0x6d, 0xbf, 0x7b, 0xff, 0xdf, 0xfb, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x80, 0xd2, 0xbf, 0x6d, 0xdb, 0xfa, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x0, 0xaa, 0x6a, 0xb7, 0xb7, 0xd5, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x69, 0xf7, 0x7e, 0xed, 0x7f, 0xdf, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xdd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0xc4, 0x5e, 0xab, 0x5b, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x92, 0xb5, 0x6d, 0xbf, 0x6d, 0xfb, 0xef, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x68, 0xfb, 0x77, 0xf5, 0xdf, 0xff, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0xa4, 0x4e, 0xdd, 0x5b, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x0, 0x50, 0xbd, 0xbb, 0xbf, 0x6d, 0xef, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x80, 0x49, 0xf3, 0xf7, 0xf6, 0xff, 0xff, 0xfd, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x0, 0x89, 0x4e, 0xdd, 0x6f, 0xdb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x40, 0xa6, 0xbc, 0xff, 0xdf, 0xf6, 0xff, 0x7f, 0xff, 0x77, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x6b, 0xf3, 0xed, 0xf6, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x96, 0xd7, 0xfe, 0x6f, 0xfb, 0xfd, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x2a, 0xed, 0xf7, 0xdb, 0xee, 0x7f, 0xf7, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xef, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x43, 0xdd, 0xba, 0x7f, 0xf7, 0x7f, 0xfb, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xed, 0x77, 0xff, 0xde, 0xf6, 0xed, 0xff, 0xff, 0xfb, 0xbf, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0x5b, 0xfd, 0xdb, 0x6d, 0xbf, 0x7f, 0x7f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xbf, 0xff, 0xf7, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf6, 0xee, 0xbf, 0xfb, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfd, 0xdf, 0x76, 0xd7, 0xde, 0xee, 0xff, 0x77, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xbf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x77, 0xeb, 0xbe, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xfe, 0xfd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xdf, 0xda, 0xbb, 0xf7, 0xdd, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xdb, 0xb6, 0x77, 0xdf, 0xfe, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xf6, 0x6d, 0xfb, 0xfd, 0xad, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xdf, 0xf7, 0xbe, 0xfb, 0xdb, 0x0};
+const uint8_t image_data[IMAGE_STRIDE * IMAGE_HEIGHT] PROGMEM = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x80, 0x58, 0xd0, 0xda, 0x6a, 0x5d, 0xbb, 0xff, 0x6f, 0xff, 0xef, 0xb7, 0xdd, 0x2d, 0xbd, 0xfb, 0xbf, 0x7d, 0xfb, 0xbe, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x20, 0x24, 0x55, 0xb7, 0xef, 0xfe, 0xfd, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xdf, 0xdb, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x10, 0x48, 0xaa, 0xde, 0xfe, 0xb7, 0x6f, 0xff, 0xf7, 0x7d, 0xff, 0x76, 0xfb, 0xee, 0xd7, 0xff, 0xef, 0xdf, 0xf7, 0x7f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x28, 0x20, 0xdd, 0xfa, 0xdd, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfb, 0xfd, 0x57, 0xbf, 0xfd, 0x7f, 0xfb, 0xff, 0xbf, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x20, 0x90, 0x72, 0x6b, 0xef, 0xee, 0xfe, 0xff, 0x7e, 0xf7, 0xef, 0x6f, 0xbb, 0xfd, 0xff, 0xed, 0xff, 0xfe, 0xfe, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x10, 0x48, 0xad, 0xdd, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xfd, 0xfe, 0xfe, 0x6b, 0xdb, 0xff, 0xdf, 0xf7, 0xf7, 0xbf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x20, 0x80, 0xd4, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xb7, 0xdf, 0xff, 0xff, 0xfb, 0xbf, 0xbf, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x0, 0x4, 0xa9, 0xa5, 0xef, 0xdb, 0xfe, 0xbd, 0xf7, 0xfb, 0xbb, 0xbf, 0xfd, 0x76, 0xed, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x20, 0x8, 0x52, 0xdd, 0x7e, 0xff, 0xff, 0xff, 0xbf, 0xdf, 0xff, 0xfd, 0xef, 0xbd, 0xfb, 0xbf, 0xb7, 0xfb, 0xfd, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x0, 0x48, 0x92, 0xfe, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0x6f, 0xdf, 0xf7, 0xd7, 0xfb, 0xff, 0xff, 0x6f, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6, 0x0, 0x0, 0x10, 0xb4, 0xa9, 0x6f, 0xf7, 0xef, 0xff, 0xff, 0xfb, 0xb7, 0xff, 0x7b, 0xaf, 0x7e, 0xff, 0xfb, 0xdf, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x0, 0x20, 0x24, 0x69, 0x77, 0xff, 0xfe, 0xff, 0xdd, 0xfd, 0xfe, 0xff, 0xfb, 0xff, 0x7d, 0xfb, 0xdf, 0x6f, 0xff, 0xbe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x0, 0x0, 0x0, 0xea, 0xde, 0xed, 0xbb, 0xff, 0xff, 0xdf, 0xdf, 0xfe, 0xdf, 0xfe, 0xef, 0xf7, 0x7f, 0xff, 0xfb, 0x77, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6, 0x0, 0x0, 0x8, 0xd5, 0xed, 0x5e, 0xf7, 0xfd, 0xff, 0xff, 0xf7, 0x77, 0xff, 0xb7, 0x7f, 0xdf, 0xfe, 0xfb, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x1, 0x40, 0x48, 0xba, 0x56, 0xbb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfd, 0xfd, 0xf7, 0xdf, 0xdf, 0xbf, 0xfd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xb4, 0x6, 0x0, 0x10, 0x6d, 0xab, 0xb5, 0x7a, 0xdf, 0xff, 0xff, 0xaf, 0xfd, 0x6f, 0xdf, 0xb7, 0xff, 0x7f, 0xff, 0xfb, 0x7d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x69, 0xd, 0x0, 0xb0, 0xf6, 0xdd, 0x6e, 0xb7, 0xfb, 0xdd, 0xf6, 0xfe, 0xbf, 0xff, 0xfb, 0xff, 0xdf, 0xff, 0xfb, 0xff, 0xef, 0x7e, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x4a, 0x59, 0x40, 0x48, 0xad, 0xb2, 0xf6, 0xed, 0xff, 0xff, 0xff, 0xdf, 0xfe, 0xfd, 0x7f, 0xfb, 0xfd, 0xff, 0x6f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xb6, 0xab, 0x80, 0xb0, 0xb6, 0xa7, 0x6d, 0x57, 0xdd, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdf, 0xbd, 0xed, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x49, 0x36, 0x1, 0xea, 0xdd, 0x4a, 0xbd, 0xbf, 0xfb, 0xff, 0xff, 0x7f, 0xef, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x7, 0xe, 0x6, 0x1e, 0xf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x24, 0x6d, 0x5, 0x6d, 0xdb, 0x5d, 0xeb, 0xed, 0xee, 0xfe, 0xdf, 0xdb, 0x7d, 0xff, 0xdf, 0xfe, 0x7d, 0xff, 0xff, 0xfd, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe7, 0xe4, 0xe4, 0x3c, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1, 0xd2, 0x2, 0xf4, 0xaf, 0xb3, 0xda, 0xff, 0xfd, 0xdf, 0xfe, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0x7b, 0xbb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe7, 0xe7, 0xe4, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x2, 0x6c, 0x3, 0xda, 0xde, 0xd6, 0xed, 0x6e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xf7, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe7, 0xe7, 0xe4, 0x3c, 0xe7, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1, 0xd9, 0xc6, 0xfd, 0xdd, 0xbb, 0xb7, 0xff, 0xbb, 0xfd, 0xf7, 0xbf, 0xed, 0xff, 0xed, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xe4, 0xf, 0xe6, 0x1c, 0xe, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x0, 0xa5, 0x8d, 0xf7, 0xbf, 0xb6, 0x7e, 0xdd, 0x7e, 0xff, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0xef, 0xff, 0xf7, 0xbb, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x6e, 0x61, 0xdf, 0x7b, 0xff, 0xed, 0xf6, 0xd7, 0xdf, 0xff, 0xff, 0x7f, 0xff, 0xbf, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x6d, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3, 0xb9, 0xeb, 0xfd, 0xdf, 0xbf, 0xff, 0x6f, 0xef, 0xfe, 0xfd, 0xbf, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x7f, 0x7b, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xdf, 0xd2, 0xff, 0x7f, 0xf5, 0xb7, 0xdf, 0xfa, 0xfe, 0xbf, 0xff, 0xf7, 0xbf, 0xfb, 0xfb, 0xff, 0xfd, 0xef, 0xef, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x6d, 0xb9, 0xbf, 0xfd, 0xff, 0xef, 0xbd, 0x6d, 0xfb, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0xda, 0xf4, 0xf7, 0xef, 0xda, 0x7e, 0x7f, 0xdf, 0xb7, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xb7, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xee, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0xb7, 0xda, 0xff, 0x7f, 0xf7, 0xe9, 0xf7, 0xdb, 0xfe, 0xf7, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0x7f, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x33, 0xfa, 0xff, 0xff, 0xab, 0xd7, 0xee, 0xb5, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0x7f, 0xfb, 0x7f, 0xff, 0xf7, 0xbf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0x3f, 0xfd, 0xfd, 0xbd, 0x5d, 0xbe, 0xbd, 0xdf, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xdb, 0xff, 0x7e, 0xfb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x9f, 0xee, 0xbf, 0xff, 0xf6, 0xea, 0xdb, 0xfb, 0x7b, 0x7f, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0x9a, 0xfd, 0xff, 0xef, 0xab, 0x55, 0xff, 0xb7, 0xff, 0xef, 0xef, 0xff, 0x7f, 0xfb, 0xdf, 0xfd, 0xff, 0xff, 0xdf, 0xb7, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x94, 0x7f, 0xff, 0xff, 0x2d, 0xfb, 0xf6, 0x6f, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xbf, 0xff, 0xfb, 0x7f, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x88, 0xf6, 0xef, 0xf6, 0xdb, 0xd6, 0xdf, 0xfd, 0xed, 0xff, 0xff, 0xff, 0xef, 0xff, 0xfd, 0xef, 0xff, 0xfb, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x62, 0xff, 0xff, 0x5f, 0x57, 0x29, 0xfd, 0xdf, 0xfe, 0xfe, 0x7f, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xf7, 0xbf, 0xff, 0xbd, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xc0, 0xff, 0xff, 0xbf, 0x9f, 0xf6, 0x6a, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xbf, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xc0, 0xee, 0xff, 0xff, 0xfe, 0xca, 0xbf, 0xeb, 0xed, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xbf, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x60, 0xff, 0xee, 0x76, 0xfb, 0xbd, 0xed, 0xb7, 0xff, 0xbf, 0xff, 0xff, 0x7f, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0x7f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff, 0xff, 0xed, 0x77, 0x35, 0xdf, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xd0, 0xfe, 0xff, 0xdf, 0xdf, 0xee, 0xdb, 0x7a, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xef, 0xbb, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x68, 0xf7, 0x7f, 0x7b, 0xbb, 0x5f, 0xf7, 0xed, 0xbf, 0xfb, 0x7f, 0xbf, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xfd, 0xbf, 0xff, 0xff, 0xe7, 0xc, 0xfe, 0xf, 0xe, 0xe6, 0x3c, 0xf, 0xfc, 0xf, 0xe, 0xe4, 0xc, 0xfe, 0xff, 0x1f, 0xf0, 0xff, 0xff, 0xef, 0xf6, 0xfd, 0xae, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xed, 0xff, 0xde, 0xff, 0xff, 0xff, 0x7, 0xe4, 0xfc, 0xe7, 0xe4, 0xe4, 0x3c, 0xe7, 0xfc, 0xc7, 0xe7, 0xe4, 0xe4, 0xfc, 0xff, 0xf, 0xa8, 0xff, 0xfe, 0xb7, 0xad, 0xb5, 0x7b, 0xfb, 0xf6, 0xff, 0xef, 0xff, 0xff, 0x7f, 0x7f, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xe7, 0x4, 0xfc, 0xe7, 0xe7, 0xe4, 0x3c, 0xe7, 0xfc, 0xf, 0xe6, 0x4c, 0x6, 0xfc, 0xff, 0x1f, 0x74, 0xff, 0xdf, 0x5f, 0xdb, 0xee, 0xdf, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xef, 0xff, 0xff, 0xff, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xe7, 0xe4, 0xff, 0xe7, 0xe7, 0xe4, 0x3c, 0xe7, 0xfc, 0x7f, 0xe4, 0x1c, 0xe7, 0xff, 0xff, 0xf, 0xe8, 0xfb, 0xff, 0xaf, 0x6a, 0x7f, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xe7, 0xc, 0xfe, 0xf, 0xc, 0xe, 0x1c, 0xe, 0xfc, 0x7, 0xe, 0xbc, 0xf, 0xfe, 0xff, 0xf, 0x48, 0xdf, 0xff, 0x7f, 0xb5, 0xd9, 0x6d, 0xbb, 0xfd, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xed, 0xf7, 0xbb, 0xef, 0xfe, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xb4, 0xff, 0xfb, 0xbf, 0xaa, 0xbb, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xe0, 0xfd, 0x7f, 0x7f, 0x49, 0xed, 0xb6, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xc0, 0xb6, 0xff, 0xbf, 0xb5, 0x76, 0x6f, 0xdb, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xdb, 0xdf, 0xff, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xa4, 0x7f, 0xed, 0x77, 0x4a, 0xed, 0xfd, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x68, 0xef, 0xfb, 0xff, 0x92, 0xaa, 0xdb, 0xee, 0xff, 0xff, 0x7f, 0xf7, 0xff, 0xff, 0xfb, 0xff, 0xed, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xd4, 0xfe, 0xb6, 0xbf, 0xb5, 0x54, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xd4, 0xfb, 0xef, 0x5d, 0xa3, 0x75, 0xbd, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0xff, 0xdf, 0xff, 0x7f, 0x7f, 0xf7, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf, 0x6, 0x6, 0xe, 0x6, 0xe, 0xfe, 0x9f, 0x7, 0xe, 0x46, 0xfe, 0xff, 0xff, 0x7, 0xa8, 0xbe, 0xef, 0xef, 0x16, 0xad, 0xdb, 0xf6, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xe7, 0x9c, 0xe7, 0xe4, 0xe4, 0xc4, 0xff, 0xf, 0xe6, 0xe4, 0x4, 0xfc, 0xff, 0xff, 0xf, 0x58, 0xbf, 0xb6, 0xbf, 0x6d, 0x52, 0xed, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x9c, 0xe7, 0x4, 0xe4, 0xf, 0xfe, 0x9f, 0xe7, 0xe7, 0xa4, 0xfc, 0xff, 0xff, 0xf, 0xf0, 0x56, 0xff, 0xf6, 0xcb, 0xb4, 0x76, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x9c, 0xe4, 0xe4, 0xe7, 0x7f, 0xfc, 0x9f, 0xe7, 0xe7, 0xe4, 0xfc, 0xff, 0xff, 0x1f, 0x0, 0xa8, 0xdd, 0x6f, 0x9f, 0xca, 0xed, 0xfe, 0xfb, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xef, 0xff, 0xdf, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xf, 0x3e, 0xe6, 0xc, 0xe6, 0x7, 0xfe, 0x9f, 0xe7, 0xf, 0xe6, 0xfc, 0xff, 0xff, 0xf, 0x0, 0x90, 0xfb, 0xbe, 0x75, 0x55, 0xdb, 0xef, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x8, 0x48, 0xef, 0xfb, 0xfb, 0xaa, 0xb6, 0xbd, 0xef, 0xff, 0xff, 0xfd, 0xb7, 0xfb, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0xa8, 0xb6, 0xb7, 0xcf, 0x55, 0xed, 0xf6, 0x7e, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xbe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x40, 0x7d, 0x7f, 0xbb, 0xaf, 0xda, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0xd0, 0xee, 0xed, 0x7f, 0x2d, 0xdb, 0xfe, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x88, 0xba, 0xbf, 0xd5, 0x76, 0xb5, 0xb5, 0xff, 0xef, 0xff, 0xff, 0xef, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x10, 0xf5, 0xf6, 0xbf, 0x5d, 0xda, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x52, 0x6e, 0x7f, 0xdb, 0xba, 0x75, 0xfb, 0xef, 0xfe, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x7f, 0xe4, 0xe0, 0xc0, 0xf1, 0xe0, 0x60, 0xe0, 0xe0, 0x7f, 0xe0, 0xe0, 0x60, 0xe0, 0xe0, 0xff, 0xff, 0x1f, 0x0, 0xa4, 0xda, 0xeb, 0xbf, 0x75, 0xed, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xde, 0x7f, 0x40, 0x4e, 0xce, 0x73, 0x4e, 0x4e, 0x4e, 0xce, 0x7f, 0x4e, 0x4e, 0xfc, 0x79, 0xfc, 0xff, 0xff, 0x1f, 0x0, 0x4a, 0xed, 0xde, 0xb6, 0xcd, 0xaa, 0xfe, 0xfb, 0xff, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x4a, 0x40, 0xce, 0x73, 0x4e, 0x7e, 0x7e, 0xc0, 0x7f, 0x4e, 0xce, 0xe0, 0xf9, 0xe0, 0xff, 0xff, 0x1f, 0x0, 0x54, 0xbb, 0xf7, 0x6d, 0x55, 0x75, 0xbb, 0x7f, 0xf7, 0xdf, 0xfb, 0xff, 0xee, 0xef, 0xff, 0xff, 0xef, 0xf7, 0xff, 0xff, 0xff, 0x7f, 0x4e, 0x7e, 0xce, 0x73, 0x4e, 0x7e, 0x7e, 0xfe, 0x7f, 0x4e, 0xce, 0xc7, 0xc9, 0xc7, 0xf3, 0xff, 0x3f, 0x0, 0xa8, 0x76, 0x7b, 0xbf, 0x6a, 0xdb, 0xf7, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x57, 0x7f, 0xce, 0xe0, 0xc0, 0xe1, 0xe0, 0x40, 0xfe, 0xe0, 0x7f, 0xe0, 0x60, 0xe0, 0x63, 0xe0, 0xf3, 0xff, 0x3f, 0x0, 0xe2, 0xdd, 0xff, 0xdf, 0xd5, 0x6a, 0x7f, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x3f, 0x0, 0x48, 0xff, 0xb6, 0xfb, 0x4b, 0xb7, 0xed, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x0, 0xfa, 0xea, 0xff, 0xff, 0xb7, 0xec, 0xfb, 0xfe, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x0, 0xe9, 0xff, 0xff, 0xff, 0xa5, 0xdd, 0xde, 0xef, 0xff, 0xef, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x0, 0x56, 0xbf, 0xfd, 0xff, 0xaf, 0xba, 0xf7, 0xfd, 0xff, 0xfd, 0x7d, 0xdf, 0xfe, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x40, 0xfe, 0xea, 0xff, 0xdf, 0x56, 0xf7, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0xf3, 0xff, 0xff, 0xff, 0xf1, 0xe3, 0xff, 0x7f, 0x80, 0xff, 0xff, 0xff, 0xfb, 0xad, 0xaa, 0x6f, 0xef, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xc9, 0xff, 0x7f, 0x80, 0x3d, 0xfd, 0xff, 0xbf, 0xaf, 0x76, 0xfb, 0xfe, 0xff, 0xff, 0xef, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xdf, 0x7f, 0x60, 0x4e, 0xe0, 0x7f, 0xe0, 0x60, 0xe0, 0x7f, 0xe0, 0x71, 0xe4, 0xe0, 0xe0, 0xf3, 0xf9, 0xff, 0x7f, 0x80, 0x7e, 0xed, 0x77, 0x7f, 0x5b, 0xfd, 0xdd, 0x7f, 0xf7, 0x7f, 0xff, 0xff, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x4e, 0xce, 0xf9, 0x7f, 0x4e, 0xce, 0xf9, 0x7f, 0xce, 0x73, 0x40, 0x7c, 0xce, 0xf3, 0xe0, 0xff, 0xff, 0x40, 0xeb, 0xbb, 0xfd, 0xdb, 0xcd, 0xaa, 0xf7, 0xed, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0x4e, 0xce, 0xf9, 0x7f, 0x4e, 0xce, 0xf9, 0x7f, 0xce, 0x73, 0xca, 0x60, 0xc0, 0xf3, 0xf9, 0xff, 0xff, 0x0, 0x95, 0xde, 0xdf, 0xff, 0x97, 0x76, 0xbf, 0xff, 0xff, 0xff, 0xbf, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfd, 0xff, 0xf7, 0x7f, 0x4e, 0xce, 0xc9, 0x7f, 0x4e, 0xce, 0xc9, 0x7f, 0xce, 0x73, 0xce, 0x47, 0xfe, 0xf3, 0xf9, 0xf3, 0xff, 0x80, 0x58, 0x75, 0xbb, 0xb6, 0x6e, 0xed, 0xed, 0xff, 0xff, 0xfe, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0xe0, 0xc0, 0xe3, 0x7f, 0xce, 0xe0, 0xe3, 0x7f, 0xce, 0x61, 0x4e, 0xe0, 0xe0, 0xe1, 0xf9, 0xf3, 0xff, 0x0, 0xa0, 0xaa, 0xf5, 0xed, 0x95, 0xda, 0x7b, 0xed, 0xfb, 0xff, 0xf7, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xb5, 0x6d, 0xdf, 0x2e, 0x6d, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x41, 0x40, 0x69, 0xdb, 0x76, 0xdb, 0xf4, 0xf6, 0xfe, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xa0, 0x96, 0xb6, 0xbb, 0x97, 0xee, 0xfb, 0x77, 0xbf, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x6d, 0x6d, 0xef, 0x36, 0x59, 0x6f, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xfd, 0xf7, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x50, 0xa9, 0xb5, 0xdd, 0x6d, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xfb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xa0, 0x52, 0x6a, 0xbb, 0xdb, 0xb6, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x0, 0xd6, 0xd6, 0x76, 0x97, 0xf4, 0xef, 0xff, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x0, 0x29, 0xad, 0x6d, 0x6d, 0xab, 0xfd, 0xed, 0xff, 0xff, 0xff, 0x7f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x0, 0xd2, 0xda, 0xda, 0xbb, 0xde, 0xb6, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x80, 0x24, 0xb5, 0x6d, 0xdb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x0, 0xac, 0x65, 0xb7, 0xb6, 0x55, 0xed, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x0, 0xd9, 0xde, 0xda, 0x6d, 0xbf, 0x7b, 0xff, 0xdf, 0xfb, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x80, 0xd2, 0xbf, 0x6d, 0xdb, 0xfa, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0x0, 0xaa, 0x6a, 0xb7, 0xb7, 0xd5, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x69, 0xf7, 0x7e, 0xed, 0x7f, 0xdf, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xdd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0xc4, 0x5e, 0xab, 0x5b, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0x0, 0x92, 0xb5, 0x6d, 0xbf, 0x6d, 0xfb, 0xef, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0x68, 0xfb, 0x77, 0xf5, 0xdf, 0xff, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0, 0xa4, 0x4e, 0xdd, 0x5b, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x0, 0x50, 0xbd, 0xbb, 0xbf, 0x6d, 0xef, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x80, 0x49, 0xf3, 0xf7, 0xf6, 0xff, 0xff, 0xfd, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x0, 0x89, 0x4e, 0xdd, 0x6f, 0xdb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x40, 0xa6, 0xbc, 0xff, 0xdf, 0xf6, 0xff, 0x7f, 0xff, 0x77, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x6b, 0xf3, 0xed, 0xf6, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x96, 0xd7, 0xfe, 0x6f, 0xfb, 0xfd, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x2a, 0xed, 0xf7, 0xdb, 0xee, 0x7f, 0xf7, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xef, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x43, 0xdd, 0xba, 0x7f, 0xf7, 0x7f, 0xfb, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xed, 0x77, 0xff, 0xde, 0xf6, 0xed, 0xff, 0xff, 0xfb, 0xbf, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0x5b, 0xfd, 0xdb, 0x6d, 0xbf, 0x7f, 0x7f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xbf, 0xff, 0xf7, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf6, 0xee, 0xbf, 0xfb, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfd, 0xdf, 0x76, 0xd7, 0xde, 0xee, 0xff, 0x77, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xbf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x77, 0xeb, 0xbe, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xfe, 0xfd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xdf, 0xda, 0xbb, 0xf7, 0xdd, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xdb, 0xb6, 0x77, 0xdf, 0xfe, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xf6, 0x6d, 0xfb, 0xfd, 0xad, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xdf, 0xf7, 0xbe, 0xfb, 0xdb};
+
+// First and last set column of each row, 0xffff and 0 when it's blank.
+const uint16_t image_rows[IMAGE_HEIGHT][2] PROGMEM = {
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 318},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 318},
+  {0, 319},
+  {0, 318},
+  {0, 319},
+  {0, 318},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 318},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 318},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 318},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 318},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 319},
+  {0, 318},
+  {0, 319},
+  {0, 319},
+};
+
+// The same image, run-length coded by row.
+const uint8_t image_runs[3508] PROGMEM = {0xf0, 0x8d, 0x1a, 0x23, 0x11, 0x15, 0x21, 0x11, 0x21, 0x21, 0x11, 0x11, 0x21, 0x11, 0x31, 0x11, 0x21, 0x31, 0xd1, 0x21, 0xc1, 0x61, 0x21, 0x21, 0x31, 0x31, 0x21, 0x11, 0x12, 0x41, 0x31, 0xb1, 0x21, 0x51, 0x21, 0x51, 0x51, 0x21, 0x81, 0x51, 0xf0, 0x8d, 0xf, 0x11, 0x14, 0x12, 0x12, 0x11, 0x11, 0x11, 0x31, 0x21, 0x51, 0x31, 0x81, 0xf1, 0x14, 0xf1, 0x1e, 0x41, 0x21, 0x21, 0x71, 0xf1, 0x21, 0x11, 0xb1, 0xf0, 0x8d, 0xff, 0x10, 0x16, 0x12, 0x12, 0x11, 0x11, 0x11, 0x41, 0x21, 0xa1, 0x21, 0x51, 0x21, 0xb1, 0x51, 0x51, 0x81, 0x21, 0x31, 0x21, 0x51, 0x31, 0x61, 0x11, 0xe1, 0x81, 0x51, 0xb1, 0x51, 0x21, 0xf0, 0x8d, 0x1e, 0x11, 0x17, 0x12, 0x31, 0x21, 0x11, 0x61, 0x31, 0xf1, 0x15, 0xf1, 0x16, 0x61, 0x91, 0x11, 0x11, 0x61, 0x21, 0xd1, 0x21, 0xf1, 0x13, 0x11, 0x21, 0xc1, 0xf0, 0x8d, 0xf, 0x11, 0x16, 0x12, 0x11, 0x32, 0x21, 0x11, 0x21, 0x41, 0x31, 0x31, 0x31, 0xf1, 0xf, 0x61, 0x31, 0x81, 0x71, 0x21, 0x21, 0x31, 0x21, 0xf1, 0xf, 0x21, 0xb1, 0x71, 0x81, 0x81, 0x51, 0xf0, 0x8c, 0xf, 0x11, 0x16, 0x12, 0x11, 0x21, 0x11, 0x21, 0x31, 0xf1, 0x15, 0xf1, 0x1a, 0x21, 0x61, 0x71, 0x91, 0x11, 0x21, 0x21, 0x21, 0xf1, 0xf, 0x51, 0x71, 0xa1, 0x61, 0x21, 0xf0, 0x8c, 0x1f, 0x11, 0x19, 0x12, 0x11, 0x21, 0x81, 0xf1, 0x26, 0xf1, 0x12, 0x71, 0x21, 0x61, 0xf1, 0x14, 0xb1, 0x71, 0x11, 0x11, 0xd1, 0xf0, 0x8c, 0x6f, 0x11, 0x15, 0x12, 0x11, 0x21, 0x11, 0x12, 0x51, 0x51, 0x21, 0x21, 0x81, 0x41, 0x41, 0x61, 0x71, 0x31, 0x71, 0x21, 0x61, 0x21, 0x31, 0x11, 0x21, 0x31, 0xf1, 0x20, 0x71, 0x61, 0xf0, 0x8c, 0x1f, 0x11, 0x15, 0x15, 0x12, 0x11, 0x11, 0x31, 0x21, 0x61, 0xf1, 0x1e, 0x61, 0xb1, 0xa1, 0x41, 0x41, 0x31, 0xb1, 0x41, 0x21, 0x31, 0x61, 0xa1, 0x81, 0x21, 0xf0, 0x8c, 0x7f, 0x11, 0x12, 0x12, 0x12, 0x12, 0x81, 0x11, 0xf1, 0x27, 0x41, 0xb1, 0x21, 0x51, 0x51, 0x71, 0x11, 0x41, 0xf1, 0x19, 0x21, 0x11, 0x51, 0x81, 0xf0, 0x88, 0x21, 0x9f, 0x11, 0x15, 0x21, 0x21, 0x12, 0x11, 0x51, 0x21, 0x31, 0x81, 0xf1, 0x15, 0x81, 0x21, 0xb1, 0x41, 0x41, 0x11, 0x11, 0x61, 0xa1, 0xa1, 0xa1, 0xa1, 0x41, 0xf0, 0x8b, 0x2f, 0x11, 0x14, 0x12, 0x12, 0x12, 0x21, 0x31, 0x31, 0x81, 0xf1, 0x10, 0x31, 0x31, 0x61, 0xf1, 0x11, 0xe1, 0x51, 0x21, 0xa1, 0x61, 0x21, 0x81, 0x51, 0x31, 0xd1, 0xf0, 0x8b, 0xef, 0x11, 0x11, 0x31, 0x41, 0x31, 0x21, 0x51, 0x31, 0xf1, 0x16, 0x71, 0x21, 0xc1, 0x21, 0xb1, 0x61, 0xb1, 0xa1, 0x81, 0x31, 0x51, 0x81, 0x11, 0xf0, 0x88, 0x21, 0x8f, 0x11, 0x14, 0x11, 0x11, 0x31, 0x21, 0x31, 0x41, 0x11, 0x31, 0x51, 0xf1, 0x19, 0x71, 0x31, 0xb1, 0x21, 0x81, 0x51, 0x21, 0x91, 0xf1, 0x15, 0x71, 0x71, 0xf0, 0x89, 0x17, 0x1d, 0x14, 0x12, 0x12, 0x31, 0x11, 0x21, 0x11, 0x11, 0x21, 0x31, 0x61, 0xf1, 0x2c, 0xe1, 0x71, 0x91, 0x91, 0x71, 0x81, 0x21, 0x91, 0x41, 0xf0, 0x86, 0x11, 0x12, 0x21, 0x11, 0x21, 0x1f, 0x11, 0x13, 0x21, 0x21, 0x21, 0x11, 0x11, 0x21, 0x11, 0x21, 0x11, 0x11, 0x41, 0x51, 0xf1, 0x16, 0x11, 0x21, 0xa1, 0x21, 0x51, 0x51, 0x21, 0xf1, 0x10, 0xa1, 0x61, 0x51, 0x31, 0xc1, 0xf0, 0x86, 0x12, 0x12, 0x21, 0x11, 0x21, 0xf, 0x21, 0x11, 0x21, 0x51, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x61, 0x31, 0x21, 0x21, 0x41, 0xd1, 0xb1, 0xf1, 0x12, 0xc1, 0xf1, 0x11, 0x31, 0x61, 0x61, 0x11, 0xf0, 0x85, 0x11, 0x12, 0x11, 0x12, 0x11, 0x22, 0x11, 0x17, 0x14, 0x12, 0x11, 0x21, 0x11, 0x11, 0x11, 0x22, 0x11, 0x21, 0x51, 0x21, 0xf1, 0x20, 0x21, 0x81, 0xd1, 0x21, 0x61, 0xf1, 0x12, 0x21, 0xf1, 0xf, 0xf1, 0x10, 0xf0, 0x2c, 0xf6, 0x1c, 0xf2, 0x35, 0x12, 0x21, 0x21, 0x31, 0x11, 0x11, 0x11, 0x17, 0x24, 0x11, 0x21, 0x21, 0x41, 0x12, 0x21, 0x21, 0x21, 0x31, 0x11, 0x11, 0x11, 0x31, 0xf1, 0x26, 0x21, 0xd1, 0xc1, 0x21, 0xf1, 0xf, 0x31, 0x41, 0x21, 0x21, 0x51, 0x51, 0xf0, 0x2e, 0xf2, 0x56, 0x12, 0x12, 0x12, 0x22, 0x21, 0x12, 0x18, 0x11, 0x41, 0x31, 0x21, 0x11, 0x11, 0x12, 0x11, 0x41, 0x71, 0x31, 0xf1, 0x1c, 0x41, 0xd1, 0xf1, 0x1d, 0x21, 0xf1, 0x14, 0xd1, 0x11, 0xf0, 0x2e, 0x32, 0x36, 0x25, 0x46, 0x43, 0xf5, 0x2d, 0x11, 0x12, 0x12, 0x12, 0x21, 0x21, 0x11, 0x11, 0x15, 0x21, 0x21, 0x21, 0x21, 0x31, 0x31, 0x11, 0x21, 0x11, 0x41, 0x21, 0x31, 0x31, 0x31, 0xc1, 0x41, 0x21, 0x31, 0x51, 0xd1, 0x21, 0x81, 0x51, 0xf1, 0x11, 0xb1, 0x21, 0xf1, 0xf, 0xf0, 0x2e, 0x32, 0x32, 0x12, 0x32, 0x12, 0x32, 0x42, 0x32, 0x32, 0xf2, 0x2d, 0x11, 0x18, 0x12, 0x21, 0x11, 0x18, 0x81, 0x11, 0x31, 0x22, 0x11, 0x11, 0x21, 0xb1, 0xb1, 0x21, 0xf1, 0x1b, 0x21, 0xf1, 0x23, 0x91, 0x41, 0x41, 0x21, 0x31, 0x21, 0x61, 0xf0, 0x2e, 0x32, 0x62, 0x32, 0x12, 0x32, 0x42, 0x32, 0xf2, 0x31, 0x11, 0x11, 0x28, 0x21, 0x21, 0x17, 0x21, 0x21, 0x41, 0x21, 0x21, 0x11, 0x31, 0x21, 0x31, 0x31, 0x21, 0x31, 0x11, 0xf1, 0x23, 0xf1, 0x11, 0xf1, 0x15, 0x41, 0xf1, 0x11, 0xc1, 0x21, 0xf0, 0x2e, 0x32, 0x62, 0x32, 0x12, 0x32, 0x42, 0x32, 0x92, 0xf2, 0x27, 0x11, 0x17, 0x22, 0x21, 0x21, 0x33, 0x71, 0x31, 0x41, 0x31, 0x41, 0x21, 0xb1, 0x31, 0x21, 0x91, 0xa1, 0x21, 0x21, 0xc1, 0x21, 0xf1, 0x18, 0xf1, 0x17, 0x31, 0xe1, 0xf0, 0x2c, 0x16, 0x72, 0x25, 0x32, 0x32, 0x34, 0x46, 0xf2, 0x26, 0x11, 0x18, 0x11, 0x12, 0x21, 0x21, 0x43, 0xa1, 0x11, 0x21, 0x21, 0x11, 0x61, 0x11, 0x31, 0x21, 0x61, 0xf1, 0x10, 0xf1, 0x14, 0xf1, 0x16, 0xe1, 0x61, 0x31, 0x21, 0x41, 0xf1, 0x11, 0xf0, 0x89, 0x38, 0x21, 0x11, 0x24, 0x51, 0x41, 0x41, 0x91, 0x21, 0x31, 0x21, 0x71, 0x11, 0x71, 0xf1, 0x19, 0xe1, 0x81, 0xf1, 0x27, 0x11, 0x21, 0x21, 0x21, 0x51, 0xf0, 0x87, 0x21, 0x16, 0x32, 0x31, 0x11, 0x41, 0xb1, 0x81, 0xd1, 0x21, 0x41, 0x31, 0x81, 0xc1, 0xb1, 0xf1, 0x24, 0x21, 0x41, 0xf1, 0x10, 0xc1, 0x21, 0xf0, 0x89, 0x66, 0x21, 0x11, 0x12, 0xf1, 0x11, 0x11, 0x11, 0x71, 0x21, 0x61, 0x21, 0x11, 0x51, 0xd1, 0xc1, 0xa1, 0x31, 0x71, 0xe1, 0xa1, 0x71, 0x61, 0x21, 0xf1, 0x11, 0xf0, 0x8a, 0x16, 0x21, 0x21, 0x11, 0x32, 0x71, 0x21, 0xf1, 0x12, 0x41, 0x41, 0x21, 0x21, 0x21, 0x21, 0xf1, 0x1b, 0xf1, 0x26, 0xf1, 0x19, 0x11, 0xe1, 0xf0, 0x8a, 0x17, 0x21, 0x21, 0x12, 0x71, 0x81, 0x31, 0x11, 0x21, 0x21, 0x61, 0x71, 0x51, 0x51, 0x21, 0xc1, 0xf1, 0x1a, 0x41, 0x21, 0xf1, 0x13, 0xc1, 0x81, 0x31, 0xa1, 0x1, 0x9f, 0x18, 0x41, 0x14, 0x12, 0x11, 0x11, 0x12, 0x1f, 0x11, 0x13, 0x25, 0x11, 0x16, 0x16, 0x12, 0x12, 0x1a, 0x5f, 0x11, 0x14, 0x9f, 0x12, 0x1b, 0x1a, 0x12, 0x5, 0xbf, 0x38, 0x24, 0x32, 0x11, 0x7f, 0x11, 0x11, 0x11, 0x14, 0x11, 0x12, 0x13, 0x14, 0x11, 0x12, 0x12, 0x6f, 0x11, 0xf, 0x11, 0x1d, 0x12, 0x1c, 0x1b, 0x1a, 0x11, 0xff, 0x0, 0xbf, 0x28, 0x12, 0x26, 0x11, 0x17, 0x17, 0x14, 0x12, 0x13, 0x21, 0x15, 0x12, 0x14, 0x16, 0x12, 0x13, 0xcf, 0x12, 0x1d, 0x1a, 0x12, 0x1a, 0x16, 0x12, 0x1b, 0x1, 0xcf, 0x18, 0x11, 0x26, 0x11, 0x13, 0x19, 0x19, 0x12, 0x14, 0x11, 0x11, 0x15, 0x12, 0x14, 0x17, 0x14, 0x17, 0x1d, 0x13, 0x6f, 0x11, 0x1b, 0xbf, 0x2, 0xcf, 0x28, 0x21, 0x11, 0x22, 0x12, 0x2f, 0x11, 0x15, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x1b, 0x12, 0x1d, 0x17, 0x2f, 0x11, 0x12, 0x1a, 0x13, 0xbf, 0x11, 0x15, 0x12, 0x11, 0x14, 0x15, 0x4, 0xdf, 0x58, 0x11, 0x21, 0x18, 0x1f, 0x11, 0x12, 0x21, 0x12, 0x15, 0x12, 0x18, 0x12, 0xaf, 0x11, 0x3f, 0x11, 0x1b, 0x1c, 0x19, 0xff, 0x10, 0xe, 0xcf, 0x78, 0x31, 0x11, 0x12, 0x18, 0x13, 0x12, 0x16, 0x12, 0x12, 0x12, 0x11, 0x17, 0x13, 0x17, 0x12, 0xff, 0x11, 0x1c, 0x1a, 0x1d, 0x4f, 0x11, 0xf, 0x1, 0xdf, 0x48, 0x31, 0x12, 0x5f, 0x11, 0x11, 0x13, 0x11, 0x11, 0x21, 0x11, 0x21, 0x11, 0x1b, 0x12, 0x17, 0x1e, 0x1f, 0x11, 0x1e, 0x1a, 0x1a, 0x1a, 0x14, 0x13, 0x15, 0x7, 0xdf, 0x98, 0x8f, 0x11, 0x26, 0x11, 0x12, 0x14, 0x11, 0x11, 0x12, 0x11, 0x5f, 0x12, 0xaf, 0x11, 0xbf, 0x11, 0x19, 0x1b, 0x3, 0xdf, 0x98, 0x12, 0x13, 0x3f, 0x11, 0x17, 0x11, 0x21, 0x18, 0x13, 0x11, 0x14, 0x12, 0x1e, 0x1f, 0x12, 0x15, 0x1a, 0x1c, 0x19, 0x2f, 0x1, 0xdf, 0x88, 0x12, 0x18, 0x13, 0x13, 0x12, 0x13, 0x12, 0x16, 0x14, 0x12, 0x12, 0x16, 0x12, 0xff, 0x10, 0x8f, 0x11, 0x18, 0x8f, 0x11, 0x5f, 0x11, 0x14, 0xb, 0xdf, 0x88, 0xcf, 0x11, 0x12, 0x16, 0x13, 0x11, 0x11, 0x22, 0x15, 0xcf, 0x11, 0xf, 0x12, 0x2f, 0x11, 0x1f, 0x11, 0x18, 0x6, 0x3f, 0x21, 0x23, 0xbf, 0x32, 0x28, 0xbf, 0x73, 0x11, 0x12, 0x4f, 0x11, 0x17, 0x12, 0x13, 0x15, 0x12, 0x12, 0x11, 0x14, 0x12, 0xf, 0x12, 0x8f, 0x11, 0x15, 0x13, 0x4f, 0x11, 0x4f, 0x1, 0x3f, 0x21, 0x23, 0xcf, 0x22, 0x28, 0xbf, 0x63, 0x11, 0x12, 0x13, 0x1b, 0x12, 0x14, 0x12, 0x13, 0x16, 0x11, 0x13, 0x15, 0x12, 0x19, 0x13, 0x1c, 0x16, 0x1d, 0x11, 0x13, 0x5f, 0x12, 0x15, 0x12, 0x1c, 0x1, 0x3f, 0x21, 0x23, 0x52, 0x5b, 0x53, 0x22, 0x23, 0x24, 0x64, 0x5a, 0x63, 0x21, 0x23, 0x52, 0x4f, 0x71, 0x8f, 0x11, 0x13, 0x12, 0x15, 0x16, 0x13, 0x11, 0x14, 0x13, 0xbf, 0x13, 0xff, 0x10, 0x15, 0x12, 0x1b, 0x14, 0xa, 0x3f, 0x71, 0x21, 0x23, 0x29, 0x23, 0x21, 0x23, 0x21, 0x23, 0x24, 0x23, 0x23, 0x39, 0x25, 0x23, 0x21, 0x23, 0x21, 0x23, 0x2f, 0x71, 0x11, 0x11, 0x19, 0x1a, 0x12, 0x12, 0x12, 0x11, 0x12, 0x11, 0x12, 0x13, 0x14, 0x12, 0x15, 0x12, 0xf, 0x11, 0xaf, 0x11, 0x17, 0x1e, 0x4f, 0x12, 0x4, 0x3f, 0x21, 0x23, 0x71, 0x29, 0x26, 0x23, 0x21, 0x23, 0x24, 0x23, 0x23, 0x5a, 0x22, 0x23, 0x22, 0x21, 0x72, 0x3f, 0x51, 0x11, 0x13, 0x1d, 0x17, 0x11, 0x12, 0x12, 0x12, 0x13, 0x18, 0x13, 0x13, 0x2f, 0x13, 0x11, 0x19, 0xf, 0x12, 0x12, 0xff, 0x0, 0x3f, 0x21, 0x23, 0x21, 0x2e, 0x26, 0x23, 0x21, 0x23, 0x24, 0x23, 0x23, 0x3d, 0x21, 0x23, 0x33, 0x23, 0x7f, 0x71, 0x11, 0x15, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x17, 0x12, 0xdf, 0x11, 0x1a, 0x7f, 0x14, 0xc, 0x3f, 0x21, 0x23, 0x52, 0x6b, 0x52, 0x63, 0x43, 0x63, 0x69, 0x63, 0x14, 0x55, 0x3f, 0x71, 0x21, 0x11, 0x15, 0x1f, 0x11, 0x11, 0x11, 0x12, 0x22, 0x12, 0x13, 0x12, 0x12, 0x12, 0x13, 0x12, 0x1f, 0x12, 0x1b, 0x11, 0x12, 0x16, 0x16, 0x13, 0x15, 0x13, 0x18, 0x15, 0xf, 0x1, 0xbf, 0x78, 0x11, 0x12, 0x1b, 0x1b, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x1c, 0x6f, 0x13, 0x3f, 0x12, 0x19, 0x17, 0x7, 0xcf, 0x98, 0x14, 0x1d, 0x17, 0x21, 0x21, 0x11, 0x11, 0x12, 0x13, 0x12, 0x12, 0x1d, 0xbf, 0x11, 0x17, 0x4f, 0x14, 0x2, 0xbf, 0xb8, 0x12, 0x12, 0x12, 0xff, 0x10, 0x12, 0x11, 0x12, 0x11, 0x12, 0x13, 0x14, 0x12, 0x12, 0x12, 0x13, 0x16, 0x7f, 0x12, 0x12, 0x16, 0x12, 0x17, 0x7f, 0x11, 0x13, 0xe, 0xbf, 0x78, 0x21, 0x11, 0x18, 0x11, 0x12, 0x16, 0x23, 0x11, 0x21, 0x11, 0x11, 0x12, 0x14, 0xbf, 0x11, 0x7f, 0x11, 0x4f, 0x12, 0x5f, 0x2, 0xbf, 0x88, 0x11, 0x12, 0x14, 0x15, 0x1d, 0x21, 0x21, 0x11, 0x11, 0x11, 0x11, 0x13, 0x12, 0x12, 0x13, 0xaf, 0x11, 0x13, 0x6f, 0x11, 0x1e, 0x12, 0x1d, 0x1c, 0xf, 0x1, 0xbf, 0x22, 0x9f, 0x32, 0x2f, 0x73, 0x11, 0x11, 0x12, 0x17, 0x12, 0x12, 0x17, 0x12, 0x11, 0x12, 0x21, 0x11, 0x11, 0x11, 0x14, 0x14, 0x15, 0xef, 0x12, 0x14, 0x15, 0xaf, 0x12, 0xb, 0x5f, 0x22, 0x24, 0x8f, 0x22, 0x21, 0x2f, 0x63, 0x11, 0x11, 0x14, 0x19, 0x14, 0x13, 0x11, 0x32, 0x11, 0x12, 0x11, 0x13, 0x11, 0x14, 0xcf, 0x11, 0x1c, 0xcf, 0x11, 0x1f, 0x11, 0x17, 0x13, 0x14, 0x17, 0x7, 0xcf, 0x51, 0x62, 0x62, 0x53, 0x62, 0x53, 0x2c, 0x64, 0x53, 0x32, 0x21, 0xaf, 0x81, 0x11, 0x11, 0x11, 0x15, 0x15, 0x17, 0x13, 0x12, 0x31, 0x11, 0x12, 0x11, 0x13, 0x12, 0x12, 0x12, 0x16, 0xff, 0x12, 0xff, 0x10, 0x9f, 0x12, 0x3, 0xbf, 0x21, 0x23, 0x23, 0x24, 0x23, 0x21, 0x23, 0x21, 0x23, 0x31, 0x5e, 0x22, 0x23, 0x21, 0x23, 0x71, 0xaf, 0x71, 0x12, 0x11, 0x16, 0x11, 0x12, 0x12, 0x17, 0x12, 0x12, 0x22, 0x21, 0x11, 0x11, 0x11, 0x12, 0x18, 0x18, 0xdf, 0x13, 0x13, 0x6f, 0x11, 0xf, 0x1, 0xbf, 0x21, 0x23, 0x23, 0x24, 0x23, 0x71, 0x21, 0x57, 0x2c, 0x24, 0x26, 0x23, 0x21, 0x11, 0x21, 0xaf, 0x81, 0x14, 0x12, 0x11, 0x11, 0x18, 0x12, 0x16, 0x21, 0x22, 0x11, 0x12, 0x11, 0x12, 0x13, 0x12, 0x14, 0x3f, 0x13, 0x14, 0x18, 0xef, 0x2, 0xbf, 0x21, 0x23, 0x23, 0x21, 0x21, 0x23, 0x21, 0x26, 0x3a, 0x2b, 0x24, 0x26, 0x23, 0x21, 0x23, 0xbf, 0xe1, 0x11, 0x11, 0x12, 0x13, 0x16, 0x12, 0x25, 0x11, 0x11, 0x21, 0x13, 0x12, 0x13, 0x19, 0x18, 0x5f, 0x12, 0x1a, 0xf, 0x11, 0x4f, 0x11, 0xd, 0xcf, 0x51, 0x35, 0x22, 0x23, 0x52, 0x22, 0x66, 0x2c, 0x24, 0x57, 0x22, 0x23, 0xaf, 0xf1, 0x10, 0x21, 0x13, 0x15, 0x15, 0x12, 0x11, 0x13, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x16, 0x3f, 0x11, 0x1c, 0x4f, 0x12, 0x1f, 0x11, 0x18, 0x2f, 0x1, 0xdf, 0x68, 0x71, 0x21, 0x11, 0x14, 0x15, 0x17, 0x15, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x14, 0x15, 0x4f, 0x11, 0x19, 0x12, 0x13, 0xaf, 0x11, 0x4f, 0x11, 0x5f, 0x1, 0xcf, 0xf8, 0xf, 0x11, 0x11, 0x11, 0x12, 0x12, 0x14, 0x12, 0x25, 0x13, 0x11, 0x11, 0x11, 0x11, 0x12, 0x13, 0x12, 0x14, 0x16, 0x1e, 0x9f, 0x11, 0x15, 0x18, 0xf, 0x12, 0x16, 0x13, 0x4, 0xdf, 0xf8, 0x11, 0x11, 0x11, 0x15, 0x17, 0x12, 0x13, 0x15, 0x11, 0x11, 0x11, 0x12, 0x17, 0x9f, 0x12, 0xaf, 0x11, 0xdf, 0x2, 0xdf, 0xf8, 0xf, 0x11, 0x12, 0x13, 0x14, 0x12, 0x1a, 0x11, 0x12, 0x21, 0x12, 0x12, 0x12, 0x19, 0x12, 0xdf, 0x12, 0x17, 0xff, 0x10, 0x15, 0xef, 0x1, 0xcf, 0xf8, 0xf, 0x31, 0x11, 0x11, 0x13, 0x17, 0x12, 0x11, 0x11, 0x12, 0x12, 0x13, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12, 0x1d, 0x7f, 0x11, 0x15, 0x5f, 0x4, 0xcf, 0x21, 0x24, 0x9f, 0xf6, 0xf, 0x31, 0x11, 0x11, 0x14, 0x12, 0x1a, 0x12, 0x13, 0x21, 0x11, 0x12, 0x1a, 0xf, 0x11, 0x5f, 0x11, 0x8f, 0x11, 0x6f, 0x11, 0x8f, 0x1, 0xcf, 0x21, 0xbf, 0x24, 0x2f, 0xc2, 0x21, 0x11, 0x21, 0x13, 0x12, 0x17, 0x12, 0x12, 0x12, 0x11, 0x13, 0x12, 0x11, 0x13, 0x12, 0x19, 0x13, 0x6f, 0x12, 0x4f, 0x11, 0xef, 0x11, 0xc, 0x37, 0x21, 0x53, 0x63, 0x33, 0x54, 0x53, 0x62, 0x53, 0x6a, 0x53, 0x53, 0x62, 0x53, 0x8f, 0xd1, 0x21, 0x11, 0x11, 0x11, 0x12, 0x14, 0x11, 0x19, 0x12, 0x11, 0x13, 0x11, 0x12, 0x17, 0x12, 0xf, 0x12, 0x1a, 0x1f, 0x13, 0x1a, 0x14, 0x2, 0x77, 0x21, 0x23, 0x21, 0x23, 0x24, 0x23, 0x23, 0x21, 0x23, 0x21, 0x23, 0x21, 0x23, 0x29, 0x23, 0x21, 0x23, 0x31, 0x27, 0x34, 0xbf, 0xc1, 0x11, 0x21, 0x11, 0x11, 0x12, 0x13, 0x14, 0x12, 0x12, 0x12, 0x12, 0x22, 0x12, 0x11, 0x11, 0x11, 0x11, 0x19, 0xaf, 0x11, 0x17, 0x5f, 0x11, 0x3f, 0x13, 0x70, 0x12, 0x11, 0x12, 0x17, 0x32, 0x42, 0x32, 0x32, 0x12, 0x62, 0x62, 0x97, 0x32, 0x12, 0x32, 0x22, 0x45, 0x52, 0xf5, 0x18, 0x1d, 0x11, 0x11, 0x21, 0x31, 0x41, 0x51, 0x21, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x31, 0x21, 0x31, 0x81, 0x31, 0x91, 0x41, 0xd1, 0x31, 0x71, 0xf1, 0x17, 0x61, 0xf1, 0x1c, 0x70, 0x32, 0x12, 0x62, 0x32, 0x42, 0x32, 0x32, 0x12, 0x62, 0x62, 0xe2, 0x32, 0x12, 0x32, 0x52, 0x33, 0x12, 0x52, 0x43, 0xf2, 0x12, 0x1d, 0x11, 0x11, 0x21, 0x31, 0x21, 0x41, 0x61, 0x11, 0x11, 0x11, 0x21, 0x21, 0x21, 0x51, 0x91, 0xa1, 0xf1, 0x1f, 0xf1, 0x10, 0xf1, 0x29, 0x11, 0x11, 0x1, 0x27, 0x23, 0x52, 0x63, 0x43, 0x53, 0x63, 0x21, 0x57, 0x6a, 0x53, 0x62, 0x35, 0x62, 0x25, 0x2f, 0xb1, 0x31, 0x14, 0x13, 0xff, 0x10, 0x13, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x17, 0x12, 0xff, 0x11, 0x7f, 0x13, 0x1f, 0x11, 0x11, 0x1, 0xff, 0x24, 0x8f, 0x22, 0x3f, 0xd1, 0x21, 0x11, 0x18, 0x12, 0x12, 0x13, 0x17, 0x21, 0x11, 0x13, 0x12, 0x12, 0x12, 0x8f, 0x12, 0x13, 0x12, 0x4f, 0x13, 0x13, 0x12, 0x16, 0xf0, 0x8e, 0x1b, 0x51, 0x11, 0x11, 0xf1, 0x16, 0x21, 0x11, 0x22, 0x51, 0x51, 0x71, 0x31, 0xf1, 0x5e, 0x11, 0x21, 0xf0, 0x8f, 0x19, 0x12, 0xf1, 0x1c, 0x11, 0x12, 0x21, 0x31, 0x21, 0x41, 0x61, 0xf1, 0xf, 0xd1, 0xf1, 0x17, 0xd1, 0x71, 0xf1, 0x1d, 0x11, 0xf0, 0x8f, 0x2a, 0x11, 0x11, 0x61, 0x21, 0xf1, 0x12, 0x11, 0x11, 0x11, 0x31, 0x41, 0x51, 0xf1, 0xf, 0x71, 0x51, 0x51, 0x21, 0xf1, 0x1c, 0xf1, 0x10, 0xf1, 0x19, 0xf0, 0x8f, 0x17, 0x72, 0x11, 0x11, 0xf1, 0x10, 0x21, 0x21, 0x11, 0x11, 0x31, 0x51, 0xf1, 0xf, 0xf1, 0x38, 0xf1, 0x27, 0x51, 0x70, 0xf2, 0x3e, 0x92, 0xf2, 0x1d, 0x63, 0xf3, 0x12, 0xf8, 0x1b, 0x61, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x51, 0x21, 0x41, 0x91, 0xf1, 0x4d, 0xf1, 0x13, 0x70, 0xf2, 0x10, 0xf2, 0x1e, 0xc2, 0xf2, 0x29, 0x52, 0x12, 0xf2, 0x11, 0x28, 0x41, 0x12, 0xf1, 0x14, 0x51, 0x11, 0x11, 0x21, 0x31, 0x21, 0x51, 0xf1, 0x1b, 0x41, 0x41, 0xf1, 0x3a, 0x31, 0x71, 0x21, 0x70, 0x26, 0x32, 0x12, 0xa6, 0x36, 0x25, 0xa6, 0x46, 0x33, 0x13, 0x32, 0x35, 0x55, 0x52, 0xf2, 0x14, 0x18, 0x61, 0x11, 0x21, 0x61, 0x31, 0x71, 0x21, 0x21, 0x11, 0x11, 0x71, 0x31, 0x91, 0x31, 0xb1, 0xf1, 0x11, 0x31, 0x71, 0xf1, 0x3a, 0x70, 0x32, 0x12, 0x32, 0x32, 0xc2, 0x32, 0x12, 0x32, 0x32, 0xc2, 0x32, 0x42, 0x32, 0x17, 0x53, 0x32, 0x42, 0x42, 0xf5, 0x13, 0x16, 0x21, 0x11, 0x51, 0x31, 0x21, 0x81, 0x21, 0x31, 0x21, 0x22, 0x11, 0x11, 0x11, 0x41, 0x51, 0x21, 0xf1, 0xf, 0xf1, 0x1d, 0xf1, 0x1c, 0xf1, 0x18, 0x71, 0x70, 0x32, 0x12, 0x32, 0x32, 0xc2, 0x32, 0x12, 0x32, 0x32, 0xc2, 0x32, 0x42, 0x32, 0x12, 0x11, 0x22, 0x25, 0x47, 0x52, 0xf2, 0x15, 0x18, 0x11, 0x11, 0x12, 0x41, 0x71, 0xd1, 0x11, 0x12, 0x21, 0x31, 0x61, 0xf1, 0x1f, 0x31, 0xf1, 0x31, 0x41, 0xf1, 0x11, 0x41, 0x70, 0x32, 0x12, 0x32, 0x32, 0x12, 0x92, 0x32, 0x12, 0x32, 0x32, 0x12, 0x92, 0x32, 0x42, 0x32, 0x32, 0x52, 0x13, 0x92, 0x52, 0x72, 0xc2, 0x17, 0x23, 0x11, 0x11, 0x11, 0x31, 0x21, 0x31, 0x11, 0x21, 0x21, 0x11, 0x31, 0x21, 0x11, 0x21, 0x41, 0x21, 0xf1, 0x13, 0xf1, 0x15, 0xf1, 0x48, 0x1, 0x67, 0x63, 0x34, 0x2a, 0x23, 0x52, 0x35, 0x2a, 0x23, 0x43, 0x22, 0x23, 0x61, 0x53, 0x44, 0x24, 0x27, 0xdc, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x15, 0x12, 0x14, 0x11, 0x21, 0x11, 0x11, 0x12, 0x14, 0x14, 0x11, 0x12, 0x15, 0xf, 0x11, 0x1d, 0x4f, 0x13, 0x14, 0xc, 0xf, 0x69, 0x91, 0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x15, 0x12, 0x13, 0x21, 0x11, 0x12, 0x12, 0x15, 0x1f, 0x14, 0x7f, 0x12, 0x14, 0x3, 0x1f, 0x59, 0x71, 0x11, 0x21, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x13, 0x12, 0x12, 0x22, 0x11, 0x14, 0x12, 0x14, 0xf, 0x12, 0x15, 0x8f, 0x4, 0x1f, 0xc9, 0x11, 0x11, 0x12, 0x21, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x21, 0x11, 0x13, 0x15, 0x18, 0x13, 0x16, 0x16, 0x7f, 0x11, 0x1f, 0x14, 0xf0, 0x90, 0x16, 0x19, 0x21, 0x21, 0x11, 0x21, 0x21, 0x41, 0x31, 0x21, 0x21, 0x12, 0x22, 0x11, 0x41, 0x21, 0xf1, 0x1e, 0xf1, 0x30, 0x91, 0x91, 0x41, 0x21, 0x41, 0xf0, 0x91, 0x1b, 0x11, 0x11, 0x12, 0x11, 0x21, 0x11, 0x21, 0x21, 0x31, 0x31, 0x21, 0x21, 0x21, 0x51, 0x71, 0xf1, 0x19, 0xb1, 0xf1, 0x2e, 0x81, 0xf1, 0x11, 0xf0, 0x91, 0x1c, 0x11, 0x11, 0x12, 0x11, 0x12, 0x11, 0x21, 0x21, 0x31, 0x31, 0x21, 0x21, 0x21, 0x21, 0x21, 0x11, 0x21, 0xf1, 0x34, 0xf1, 0x12, 0xf1, 0x27, 0x11, 0xf0, 0x91, 0xf, 0x21, 0x11, 0x21, 0x21, 0x11, 0x21, 0x21, 0x31, 0x31, 0x11, 0x12, 0x12, 0x81, 0xe1, 0x51, 0xf1, 0x27, 0xf1, 0x2b, 0x51, 0x41, 0xf0, 0x92, 0x1e, 0x12, 0x11, 0x12, 0x21, 0x11, 0x21, 0x21, 0x21, 0x11, 0x21, 0x21, 0x21, 0x11, 0x11, 0x21, 0x71, 0x21, 0xf1, 0x22, 0x41, 0xf1, 0x35, 0xd1, 0xf0, 0x92, 0xff, 0x10, 0x12, 0x21, 0x11, 0x21, 0x21, 0x11, 0x21, 0x41, 0x31, 0x11, 0x41, 0x21, 0x21, 0x21, 0xf1, 0x17, 0xf1, 0x35, 0xe1, 0xc1, 0x71, 0xf0, 0x92, 0x1d, 0x12, 0x12, 0x12, 0x11, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x11, 0xf1, 0x2f, 0xf1, 0x30, 0xb1, 0xc1, 0x31, 0xf0, 0x93, 0xff, 0x20, 0x11, 0x21, 0x11, 0x22, 0x31, 0x21, 0x11, 0x21, 0x21, 0x21, 0x11, 0x11, 0x11, 0x11, 0x21, 0xf1, 0x22, 0xf1, 0x22, 0xf1, 0x15, 0xf1, 0x16, 0x1, 0x2f, 0xe9, 0x21, 0x12, 0x12, 0x14, 0x12, 0x11, 0x12, 0x13, 0x12, 0x12, 0x16, 0x13, 0x14, 0x1d, 0x14, 0x18, 0x8f, 0x14, 0x13, 0x7, 0x3f, 0xc9, 0x11, 0x21, 0x11, 0x18, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x15, 0xf, 0x11, 0x1f, 0x16, 0x4, 0x3f, 0xe9, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x13, 0x12, 0x14, 0x12, 0x12, 0x11, 0x11, 0x15, 0x1f, 0x16, 0xf, 0x11, 0x1, 0x4f, 0xc9, 0x21, 0x11, 0x12, 0x13, 0x14, 0x16, 0x11, 0x12, 0x1a, 0x15, 0x9f, 0x11, 0x8f, 0x13, 0xf, 0x11, 0x13, 0x12, 0x7, 0x4f, 0xe9, 0x31, 0x12, 0x14, 0x11, 0x12, 0x11, 0x11, 0x13, 0x12, 0x11, 0x12, 0x15, 0xcf, 0x15, 0x13, 0x6f, 0x1, 0x4f, 0xd9, 0x21, 0x21, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12, 0x16, 0x12, 0x12, 0x12, 0x12, 0x19, 0x1b, 0x1b, 0xef, 0x12, 0xff, 0x11, 0x12, 0x1, 0x5f, 0xe9, 0x11, 0x12, 0x12, 0x18, 0x13, 0x11, 0x11, 0x19, 0x7f, 0x11, 0x16, 0x8f, 0x14, 0x15, 0xc, 0x5f, 0xd9, 0x21, 0x11, 0x11, 0x23, 0x11, 0x11, 0x13, 0x14, 0x12, 0x11, 0x12, 0x7f, 0x11, 0xcf, 0x15, 0x8, 0x6f, 0xe9, 0x11, 0x11, 0x11, 0x14, 0x13, 0x13, 0x17, 0x12, 0x12, 0x12, 0x14, 0xcf, 0x11, 0xff, 0x13, 0x16, 0x19, 0x12, 0x2, 0x6f, 0x99, 0x22, 0x21, 0x11, 0x22, 0x17, 0x14, 0x12, 0x5f, 0x11, 0xdf, 0x11, 0x1f, 0x13, 0x13, 0x1e, 0xb, 0x7f, 0x99, 0x21, 0x31, 0x11, 0x23, 0x11, 0x11, 0x13, 0x16, 0x12, 0x12, 0x12, 0x13, 0xef, 0x14, 0x3f, 0x11, 0x1b, 0x7, 0x7f, 0x79, 0x21, 0x22, 0x11, 0x21, 0x14, 0x1e, 0x12, 0x12, 0x3f, 0x11, 0x1b, 0x13, 0x13, 0x2f, 0x13, 0xdf, 0x11, 0x3, 0x8f, 0x69, 0x11, 0x12, 0x11, 0x12, 0x22, 0x15, 0x12, 0x13, 0x12, 0x1a, 0x15, 0xcf, 0x15, 0x15, 0x12, 0x12, 0xa, 0x8f, 0x79, 0x11, 0x12, 0x21, 0x14, 0x11, 0x12, 0x1b, 0x12, 0x12, 0x16, 0x5f, 0x11, 0x9f, 0x15, 0x6, 0x9f, 0x49, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x12, 0x16, 0x16, 0x12, 0x12, 0x13, 0x1a, 0x13, 0x1f, 0x11, 0x13, 0xbf, 0x13, 0x16, 0xff, 0x10, 0x12, 0xf0, 0x9a, 0x14, 0x11, 0x31, 0x21, 0x11, 0x31, 0x81, 0x31, 0xb1, 0x21, 0xf1, 0x11, 0xf1, 0x4c, 0xb1, 0xa1, 0xf0, 0x9a, 0x13, 0x21, 0x21, 0x61, 0x31, 0x81, 0x41, 0x21, 0x21, 0x51, 0x21, 0xf1, 0x15, 0xb1, 0xf1, 0x10, 0xf1, 0x21, 0xe1, 0x71, 0x71, 0xf0, 0x9c, 0x12, 0x21, 0x21, 0x11, 0x11, 0x81, 0x21, 0x31, 0x21, 0x21, 0x61, 0x81, 0x71, 0xf1, 0xf, 0xf1, 0x34, 0x91, 0xc1, 0x71, 0x21, 0x11, 0xf0, 0x9c, 0x22, 0x21, 0x41, 0x31, 0x91, 0x31, 0x71, 0x71, 0x71, 0xf1, 0x18, 0xf1, 0x3f, 0xf1, 0x14, 0xf0, 0x9e, 0x21, 0xb1, 0x21, 0x21, 0x31, 0x31, 0x11, 0x21, 0x41, 0x21, 0x31, 0xe1, 0x31, 0x21, 0x21, 0xf1, 0x48, 0x71, 0x21, 0x61, 0xf0, 0xa4, 0x21, 0x31, 0x31, 0x21, 0x11, 0x31, 0x51, 0xa1, 0x41, 0xf1, 0x52, 0x31, 0x21, 0x81, 0xa1, 0x31, 0xf0, 0xa3, 0x51, 0x41, 0x61, 0x21, 0x11, 0x21, 0x41, 0x31, 0x41, 0x51, 0x31, 0x21, 0xf1, 0x10, 0xf1, 0x41, 0x81, 0xa1, 0x1, 0x4f, 0x3a, 0x13, 0x12, 0x12, 0x12, 0x12, 0x14, 0x13, 0x15, 0x12, 0x4f, 0x11, 0x16, 0x2f, 0x15, 0x8, 0x5f, 0x1a, 0x21, 0x12, 0x15, 0x12, 0x12, 0x12, 0x16, 0x17, 0x12, 0x11, 0x1f, 0x11, 0xbf, 0x12, 0xf, 0x11, 0x15, 0x14, 0x15, 0x13, 0x17, 0x12, 0x2};
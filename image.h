@@ -0,0 +1,31 @@
+/*
+  Generated by bin2c.py from ironic.data. Do not edit; convert the image again.
+*/
+
+#ifndef _IMAGE_H_
+#define _IMAGE_H_
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+// Size of the image in pixels, and where its top-left corner goes on the
+// canvas.
+#define IMAGE_WIDTH     320
+#define IMAGE_HEIGHT    120
+#define IMAGE_X         0
+#define IMAGE_Y         0
+
+// Bytes per row in image_data, and the bit of each byte holding its
+// leftmost pixel: the least significant one.
+#define IMAGE_STRIDE    40
+#define IMAGE_LSB_FIRST 1
+
+// Identifies the image, so that a print is only resumed with the image
+// it was started with.
+#define IMAGE_ID        0x67f9
+
+extern const uint8_t image_data[IMAGE_STRIDE * IMAGE_HEIGHT] PROGMEM;
+extern const uint16_t image_rows[IMAGE_HEIGHT][2] PROGMEM;
+extern const uint8_t image_runs[] PROGMEM;
+
+#endif
@@ -0,0 +1,152 @@
+#!/bin/python
+
+# Writes a bilevel image for the printer, shared by png2c.py and bin2c.py:
+# image.h, with its size, where it goes on the canvas and how it's packed as
+# compile-time constants, and image.c, with the image packed 1bpp, indexed by
+# row and run-length coded.
+
+import os
+
+CANVAS_WIDTH, CANVAS_HEIGHT = 320, 120
+
+# Packs rows of 0/1 pixels, 8 to a byte, leftmost pixel in the least
+# significant bit, each row starting on a byte.
+def pack(rows, width):
+  stride = (width + 7) // 8
+  packed = []
+  for row in rows:
+    for i in range(0, stride):
+      val = 0
+      for j in range(0, 8):
+        if i * 8 + j < width:
+          val |= row[i * 8 + j] << j
+      packed.append(val)
+  return packed
+
+# Indexes the set pixels of each row: the first and last set column, or
+# 0xffff and 0 for a blank row, so that the printer can skip blank rows and
+# stop each row at its last set pixel.
+def row_index(rows):
+  str_out = "\n// First and last set column of each row, 0xffff and 0 when it's blank.\n"
+  str_out += "const uint16_t image_rows[IMAGE_HEIGHT][2] PROGMEM = {\n"
+  for row in rows:
+    used = [x for x, v in enumerate(row) if v]
+    if not used:
+      str_out += "  {0xffff, 0},\n"
+    else:
+      str_out += "  {%d, %d},\n" % (used[0], used[-1])
+  return str_out + "};\n"
+
+# Run-length codes the image, for printers built with IMAGE_RLE. Each row is
+# the lengths of its runs of blank and set pixels in turn, starting with a
+# blank one. A length is a nibble, low one first, or 15 and two more nibbles
+# for one of 15 to 255; a longer run goes on after a 0.
+def row_runs(rows):
+  nibbles = []
+  for row in rows:
+    x, color = 0, 0
+    while x < len(row):
+      n = 0
+      while x + n < len(row) and row[x + n] == color:
+        n += 1
+      x += n
+      while n > 255:
+        nibbles += [15, 15, 15, 0]
+        n -= 255
+      nibbles += [n] if n < 15 else [15, n & 15, n >> 4]
+      color ^= 1
+  if len(nibbles) % 2:
+    nibbles.append(0)
+  runs = [nibbles[i] | nibbles[i + 1] << 4 for i in range(0, len(nibbles), 2)]
+  str_out = "\n// The same image, run-length coded by row.\n"
+  str_out += "const uint8_t image_runs[%d] PROGMEM = {" % len(runs)
+  str_out += ", ".join(hex(n) for n in runs)
+  return str_out + "};\n", len(runs)
+
+# CRC-16/CCITT of a list of bytes.
+def crc16(data, crc=0xffff):
+  for b in data:
+    crc ^= b << 8
+    for _ in range(8):
+      crc = (crc << 1) ^ 0x1021 if crc & 0x8000 else crc << 1
+    crc &= 0xffff
+  return crc
+
+# Tells images apart, for the printer's journal: a CRC of the packed image,
+# its size and where it goes.
+def image_id(packed, width, height, x, y):
+  return crc16(packed + [width & 0xff, width >> 8, height, x & 0xff, x >> 8, y])
+
+def header(width, height, x, y, source_name, tool, ident):
+  return '\n'.join([
+    '/*',
+    '  Generated by %s from %s. Do not edit; convert the image again.' % (tool, source_name),
+    '*/',
+    '',
+    '#ifndef _IMAGE_H_',
+    '#define _IMAGE_H_',
+    '',
+    '#include <stdint.h>',
+    '#include <avr/pgmspace.h>',
+    '',
+    '// Size of the image in pixels, and where its top-left corner goes on the',
+    '// canvas.',
+    '#define IMAGE_WIDTH     %d' % width,
+    '#define IMAGE_HEIGHT    %d' % height,
+    '#define IMAGE_X         %d' % x,
+    '#define IMAGE_Y         %d' % y,
+    '',
+    '// Bytes per row in image_data, and the bit of each byte holding its',
+    '// leftmost pixel: the least significant one.',
+    '#define IMAGE_STRIDE    %d' % ((width + 7) // 8),
+    '#define IMAGE_LSB_FIRST 1',
+    '',
+    '// Identifies the image, so that a print is only resumed with the image',
+    '// it was started with.',
+    '#define IMAGE_ID        0x%04x' % ident,
+    '',
+    'extern const uint8_t image_data[IMAGE_STRIDE * IMAGE_HEIGHT] PROGMEM;',
+    'extern const uint16_t image_rows[IMAGE_HEIGHT][2] PROGMEM;',
+    'extern const uint8_t image_runs[] PROGMEM;',
+    '',
+    '#endif',
+  ]) + '\n'
+
+# Checks that an image of this size fits on the canvas at (x, y).
+def check_fits(width, height, x, y):
+  if width < 1 or height < 1 or x < 0 or y < 0 or x + width > CANVAS_WIDTH or y + height > CANVAS_HEIGHT:
+    print("ERROR: a {}x{} image at ({}, {}) doesn't fit on the {}x{} canvas!".format(
+      width, height, x, y, CANVAS_WIDTH, CANVAS_HEIGHT))
+    return False
+  return True
+
+# Writes image.h and image.c into `directory` from rows of 0/1 pixels, 1 to
+# ink. Returns the sizes of the packed and run-length coded image.
+def write(rows, x, y, source_name, tool, directory='.'):
+  width, height = len(rows[0]), len(rows)
+  packed = pack(rows, width)
+  runs, size = row_runs(rows)
+
+  str_out = '#include "image.h"\n\nconst uint8_t image_data[IMAGE_STRIDE * IMAGE_HEIGHT] PROGMEM = {'
+  str_out += ", ".join(hex(val) for val in packed) + "};\n"
+  str_out += row_index(rows)
+  str_out += runs
+
+  with open(os.path.join(directory, 'image.h'), 'w') as f:
+    f.write(header(width, height, x, y, source_name, tool, image_id(packed, width, height, x, y)))
+  with open(os.path.join(directory, 'image.c'), 'w') as f:
+    f.write(str_out)
+  return len(packed), size
+
+# Reads back image.h and image.c from `directory`: the rows of pixels, and
+# where the image goes on the canvas.
+def read(directory='.'):
+  import re
+  consts = dict((m.group(1), int(m.group(2))) for m in
+                re.finditer(r'#define IMAGE_(\w+)\s+(\d+)', open(os.path.join(directory, 'image.h')).read()))
+  text = open(os.path.join(directory, 'image.c')).read()
+  m = re.search(r'image_data\[[^\]]*\]\s*PROGMEM\s*=\s*\{([^}]*)\}', text)
+  data = [int(v, 0) for v in m.group(1).replace(',', ' ').split()]
+  width, height, stride = consts['WIDTH'], consts['HEIGHT'], consts['STRIDE']
+  rows = [[data[y * stride + x // 8] >> (x % 8) & 1 for x in range(width)] for y in range(height)]
+  return rows, consts['X'], consts['Y']
@@ -0,0 +1,682 @@
+#!/bin/python
+
+# Compiles a macro script (.mac) into the flash-resident program interpreted by
+# Engine.c, as a header to include from the script's .c file.
+#
+#   # Comments run to the end of the line.
+#   const GAP = 50                  named constant, any integer expression
+#   extern sync SyncController      routine provided by C code
+#   native print PrintImage         C function called for each report until
+#                                   it's done, see Native_t in Engine.h
+#   routine main                    starts a routine; the first one defined is
+#                                   the entry point
+#     press A                       A for BUTTON_DURATION
+#     hold L+R for 10               buttons for a duration, in engine ticks
+#     hold B stick right for 10     buttons with the left stick pushed
+#     move up-left for 300          the left stick alone; also (170, 128)
+#     wait GAP * 2                  nothing pressed
+#     call sync                     runs a routine, or a native
+#     ret                           (implied at the end of a routine)
+#     end                           stops the script
+#     loop 55 / loop r0 / forever   loops, closed by next
+#     set r0 1 / add r0 -1          registers r0 to r3
+#     if r0 == 6 / else / endif     also !=
+#     mark 1                        marks a phase for the host tools, 1 to
+#                                   255; mark 1 starts a cycle
+#   done:                           a label, for goto done
+#
+# Adjacent identical steps are merged, and durations are split into steps the
+# packed encoding represents exactly, so the generated program holds every
+# report for as long as written. No path through the program may run more
+# than MAX_OPS control operations between two steps.
+#
+# -D NAME=value sets a const to another value than the script's, such as
+# PAGES for delete_box. image() lays the same program out for upload.py,
+# as bytes rather than C.
+
+import sys, os, re, ast, getopt
+import imagec
+
+BUTTONS = {
+  'Y': 0x01, 'B': 0x02, 'A': 0x04, 'X': 0x08,
+  'L': 0x10, 'R': 0x20, 'ZL': 0x40, 'ZR': 0x80,
+  'MINUS': 0x100, 'PLUS': 0x200, 'LCLICK': 0x400, 'RCLICK': 0x800,
+  'HOME': 0x1000, 'CAPTURE': 0x2000,
+}
+STICK_MIN, STICK_CENTER, STICK_MAX = 0, 128, 255
+LEVELS = [STICK_MIN, STICK_CENTER, STICK_MAX]
+POSITIONS = {
+  'up-left': (0, 0), 'up': (1, 0), 'up-right': (2, 0),
+  'left': (0, 1), 'center': (1, 1), 'right': (2, 1),
+  'down-left': (0, 2), 'down': (1, 2), 'down-right': (2, 2),
+}
+POS_NAMES = {
+  (0, 0): 'POS_UP_LEFT', (1, 0): 'POS_UP', (2, 0): 'POS_UP_RIGHT',
+  (0, 1): 'POS_LEFT', (1, 1): 'POS_CENTER', (2, 1): 'POS_RIGHT',
+  (0, 2): 'POS_DOWN_LEFT', (1, 2): 'POS_DOWN', (2, 2): 'POS_DOWN_RIGHT',
+}
+CONSTANTS = {'BUTTON_DURATION': 10}
+
+# Step durations are in engine ticks (ENGINE_TICK_MS), up to MAX_DURATION.
+MAX_DURATION = 636
+
+# Opcodes, in Opcode_t's order, and the low nibble of their first byte.
+OPCODES = ['END', 'CALL', 'RET', 'LOOP', 'LOOP_REG', 'FOREVER', 'NEXT', 'SET_REG',
+           'ADD_REG', 'SKIP_IF_EQ', 'SKIP_IF_NE', 'JUMP', 'MARK', 'NATIVE']
+STEP_RAW, STEP_OP = 0x0F, 0x09
+
+# Uploaded images (see Upload.h): a header, the routine table, the routines.
+UPLOAD_MAGIC, UPLOAD_VERSION, UPLOAD_SYNC = b'SC', 1, 0xFFFF
+
+# Control operations the engine runs per report at most, as Engine.h's
+# VM_MAX_OPS; a longer run of them between steps gets a neutral report in the
+# middle of the script's input.
+MAX_OPS = 16
+
+# Control instruction lengths, opcode byte included.
+OP_LENGTHS = {
+  'END': 1, 'CALL': 2, 'RET': 1, 'LOOP': 3, 'LOOP_REG': 2, 'FOREVER': 1,
+  'NEXT': 1, 'SET_REG': 4, 'ADD_REG': 4, 'SKIP_IF_EQ': 4, 'SKIP_IF_NE': 4,
+  'JUMP': 3, 'MARK': 2, 'NATIVE': 2,
+}
+
+class CompileError(Exception):
+  pass
+
+class Step(object):
+  def __init__(self, buttons, lx, ly, duration, line):
+    self.buttons, self.lx, self.ly = buttons, lx, ly
+    self.duration, self.line = duration, line
+
+  def same_report(self, other):
+    return (self.buttons, self.lx, self.ly) == (other.buttons, other.lx, other.ly)
+
+  def grid(self):
+    if self.lx in LEVELS and self.ly in LEVELS:
+      return (LEVELS.index(self.lx), LEVELS.index(self.ly))
+    return None
+
+  def length(self):
+    single = self.buttons & (self.buttons - 1) == 0
+    return 2 + (0 if single else 2) + (0 if self.grid() else 2)
+
+  def c(self):
+    names = [n for n in sorted(BUTTONS, key=BUTTONS.get) if self.buttons & BUTTONS[n]]
+    button = ' | '.join('SWITCH_' + n for n in names) or '0'
+    grid = self.grid()
+    single = len(names) <= 1
+    if grid and single:
+      if self.buttons == 0 and grid == (1, 1):
+        return 'WAIT(%d)' % self.duration
+      if self.buttons == 0:
+        return 'MOVE(%s, %d)' % (POS_NAMES[grid], self.duration)
+      if grid == (1, 1) and self.duration == CONSTANTS['BUTTON_DURATION']:
+        return 'PRESS(%s)' % button
+      return 'STEP(%s, %s, %d)' % (button, POS_NAMES[grid], self.duration)
+    if grid:
+      return 'STEP_BUTTONS(%s, %s, %d)' % (button, POS_NAMES[grid], self.duration)
+    if single:
+      return 'STEP_STICK(%s, %d, %d, %d)' % (button, self.lx, self.ly, self.duration)
+    return '0xFF, 0x%02x, 0x%02x, %d, %d, STEP_DURATION(%d)' % (
+      self.buttons & 0xFF, self.buttons >> 8, self.lx, self.ly, self.duration)
+
+  # The step as bytes, as the C macros lay it out.
+  def encode(self, index):
+    single = self.buttons & (self.buttons - 1) == 0
+    grid = self.grid()
+    out = [(self.buttons.bit_length() if single else STEP_RAW) << 4 |
+           (grid[1] * 3 + grid[0] if grid else STEP_RAW)]
+    if not single:
+      out += [self.buttons & 0xFF, self.buttons >> 8]
+    if not grid:
+      out += [self.lx, self.ly]
+    d = self.duration
+    return out + [d if d < 128 else 128 + ((d - 128) >> 2)]
+
+class Op(object):
+  def __init__(self, name, args, line, target=None):
+    self.name, self.args, self.line, self.target = name, args, line, target
+
+  def length(self):
+    return OP_LENGTHS[self.name]
+
+  def c(self):
+    if not self.args:
+      return self.name
+    return '%s(%s)' % (self.name, ', '.join(str(a) for a in self.args))
+
+  # The operation as bytes, with `index` numbering routines and natives.
+  def encode(self, index):
+    args = [index[a] if a in index else int(a[1:]) if str(a).startswith('R') else a for a in self.args]
+    out = [OPCODES.index(self.name) << 4 | STEP_OP]
+    if self.length() == 3:
+      return out + [args[0] & 0xFF, (args[0] >> 8) & 0xFF]
+    if self.length() == 4:
+      return out + [args[0], args[1] & 0xFF, (args[1] >> 8) & 0xFF]
+    return out + args
+
+class Label(object):
+  def __init__(self, name, loops, line):
+    self.name, self.loops, self.line = name, loops, line
+
+class Routine(object):
+  def __init__(self, name, line):
+    self.name, self.line = name, line
+    self.code = []
+    self.extern = None
+    self.native = None
+
+  def c_name(self):
+    return self.native or self.extern or ''.join(p.capitalize() for p in self.name.split('_'))
+
+  def enum(self):
+    return ('NATIVE_' if self.native else '') + self.name.upper()
+
+# Evaluates an integer expression over numbers and constants.
+def evaluate(expr, constants, line):
+  def walk(node):
+    if isinstance(node, ast.Expression):
+      return walk(node.body)
+    if isinstance(node, ast.BinOp):
+      ops = {ast.Add: lambda a, b: a + b, ast.Sub: lambda a, b: a - b,
+             ast.Mult: lambda a, b: a * b, ast.FloorDiv: lambda a, b: a // b,
+             ast.Div: lambda a, b: a // b, ast.Mod: lambda a, b: a % b}
+      if type(node.op) in ops:
+        return ops[type(node.op)](walk(node.left), walk(node.right))
+    if isinstance(node, ast.UnaryOp) and isinstance(node.op, ast.USub):
+      return -walk(node.operand)
+    if isinstance(node, ast.Name):
+      if node.id not in constants:
+        raise CompileError('line %d: unknown constant %s' % (line, node.id))
+      return constants[node.id]
+    value = node.value if hasattr(node, 'value') else getattr(node, 'n', None)
+    if isinstance(value, int):
+      return value
+    raise CompileError('line %d: bad expression %s' % (line, expr))
+  try:
+    return walk(ast.parse(expr.strip(), mode='eval'))
+  except SyntaxError:
+    raise CompileError('line %d: bad expression %s' % (line, expr))
+
+def parse_buttons(text, line):
+  mask = 0
+  for name in text.upper().split('+'):
+    if name not in BUTTONS:
+      raise CompileError('line %d: unknown button %s' % (line, name))
+    mask |= BUTTONS[name]
+  return mask
+
+def parse_stick(text, constants, line):
+  text = text.strip()
+  if text in POSITIONS:
+    lx, ly = POSITIONS[text]
+    return LEVELS[lx], LEVELS[ly]
+  m = re.match(r'^\((.+),(.+)\)$', text)
+  if not m:
+    raise CompileError('line %d: unknown stick position %s' % (line, text))
+  lx, ly = evaluate(m.group(1), constants, line), evaluate(m.group(2), constants, line)
+  if not (0 <= lx <= 255 and 0 <= ly <= 255):
+    raise CompileError('line %d: stick position out of range' % line)
+  return lx, ly
+
+def parse_register(text, line):
+  m = re.match(r'^r([0-3])$', text)
+  if not m:
+    raise CompileError('line %d: unknown register %s' % (line, text))
+  return 'R' + m.group(1)
+
+def duration(text, constants, line):
+  value = evaluate(text, constants, line)
+  if value < 0:
+    raise CompileError('line %d: negative duration' % line)
+  return value
+
+# Parses the source into routines of steps, ops and labels. Loops stay as
+# LOOP/NEXT ops; ifs are lowered to skips, jumps and labels. `overrides` take
+# the place of the script's consts of the same names, each of which it must
+# declare.
+def parse(source, overrides={}):
+  constants = dict(CONSTANTS)
+  routines = []
+  routine = None
+  blocks = []
+  labels = [0]
+  declared = set()
+
+  def emit(item):
+    if routine is None or routine.extern or routine.native:
+      raise CompileError('line %d: code outside of a routine' % lineno)
+    routine.code.append(item)
+
+  def loop_path():
+    return tuple(b[1] for b in blocks if b[0] == 'loop')
+
+  def new_label():
+    labels[0] += 1
+    return '.L%d' % labels[0]
+
+  def check_closed():
+    if blocks:
+      raise CompileError('line %d: unclosed %s' % (blocks[-1][2], blocks[-1][0]))
+
+  for lineno, raw in enumerate(source.splitlines(), 1):
+    text = raw.split('#')[0].strip()
+    if not text:
+      continue
+    words = text.split(None, 1)
+    word, rest = words[0], (words[1] if len(words) > 1 else '')
+    m = None
+
+    if word == 'const':
+      m = re.match(r'^(\w+)\s*=\s*(.+)$', rest)
+      if not m:
+        raise CompileError('line %d: expected const NAME = value' % lineno)
+      constants[m.group(1)] = overrides.get(m.group(1), evaluate(m.group(2), constants, lineno))
+      declared.add(m.group(1))
+    elif word in ('routine', 'extern', 'native'):
+      check_closed()
+      names = rest.split()
+      if len(names) != (1 if word == 'routine' else 2):
+        raise CompileError('line %d: bad %s' % (lineno, word))
+      if names[0] in [r.name for r in routines]:
+        raise CompileError('line %d: routine %s defined twice' % (lineno, names[0]))
+      routine = Routine(names[0], lineno)
+      if word == 'extern':
+        routine.extern = names[1]
+      elif word == 'native':
+        routine.native = names[1]
+      routines.append(routine)
+    elif re.match(r'^\w+:$', text):
+      emit(Label(text[:-1], loop_path(), lineno))
+    elif word == 'goto':
+      emit(Op('JUMP', [], lineno, target=(rest, loop_path())))
+    elif word == 'call':
+      emit(Op('CALL', [], lineno, target=rest))
+    elif word == 'mark':
+      mark = evaluate(rest, constants, lineno)
+      if not 1 <= mark <= 0xFF:
+        raise CompileError('line %d: mark out of range' % lineno)
+      emit(Op('MARK', [mark], lineno))
+    elif word in ('ret', 'end') and not rest:
+      emit(Op(word.upper(), [], lineno))
+    elif word == 'forever' and not rest:
+      blocks.append(('loop', lineno, lineno))
+      emit(Op('FOREVER', [], lineno))
+    elif word == 'loop':
+      blocks.append(('loop', lineno, lineno))
+      if re.match(r'^r\d$', rest):
+        emit(Op('LOOP_REG', [parse_register(rest, lineno)], lineno))
+      else:
+        count = evaluate(rest, constants, lineno)
+        if not 0 <= count <= 0xFFFF:
+          raise CompileError('line %d: loop count out of range' % lineno)
+        emit(Op('LOOP', [count], lineno))
+    elif word == 'next' and not rest:
+      if not blocks or blocks[-1][0] != 'loop':
+        raise CompileError('line %d: next without loop' % lineno)
+      blocks.pop()
+      emit(Op('NEXT', [], lineno))
+    elif word in ('set', 'add'):
+      m = re.match(r'^(\S+)\s+(.+)$', rest)
+      if not m:
+        raise CompileError('line %d: expected %s rN value' % (lineno, word))
+      value = evaluate(m.group(2), constants, lineno) & 0xFFFF
+      emit(Op(word.upper() + '_REG', [parse_register(m.group(1), lineno), value], lineno))
+    elif word == 'if':
+      m = re.match(r'^(\S+)\s*(==|!=)\s*(.+)$', rest)
+      if not m:
+        raise CompileError('line %d: expected if rN == value' % lineno)
+      reg = parse_register(m.group(1), lineno)
+      value = evaluate(m.group(3), constants, lineno) & 0xFFFF
+      # Skip the jump to the else branch when the condition holds
+      skip = 'SKIP_IF_EQ' if m.group(2) == '==' else 'SKIP_IF_NE'
+      orelse = new_label()
+      emit(Op(skip, [reg, value], lineno))
+      emit(Op('JUMP', [], lineno, target=(orelse, loop_path())))
+      blocks.append(('if', orelse, lineno))
+    elif word == 'else' and not rest:
+      if not blocks or blocks[-1][0] != 'if':
+        raise CompileError('line %d: else without if' % lineno)
+      orelse = blocks.pop()[1]
+      done = new_label()
+      emit(Op('JUMP', [], lineno, target=(done, loop_path())))
+      emit(Label(orelse, loop_path(), lineno))
+      blocks.append(('else', done, lineno))
+    elif word == 'endif' and not rest:
+      if not blocks or blocks[-1][0] not in ('if', 'else'):
+        raise CompileError('line %d: endif without if' % lineno)
+      emit(Label(blocks.pop()[1], loop_path(), lineno))
+    elif word == 'press':
+      emit(Step(parse_buttons(rest, lineno), STICK_CENTER, STICK_CENTER,
+                constants['BUTTON_DURATION'], lineno))
+    elif word == 'hold':
+      m = re.match(r'^(\S+)(?:\s+stick\s+(.+?))?\s+for\s+(.+)$', rest)
+      if not m:
+        raise CompileError('line %d: expected hold BUTTONS [stick POS] for N' % lineno)
+      lx, ly = STICK_CENTER, STICK_CENTER
+      if m.group(2):
+        lx, ly = parse_stick(m.group(2), constants, lineno)
+      emit(Step(parse_buttons(m.group(1), lineno), lx, ly,
+                duration(m.group(3), constants, lineno), lineno))
+    elif word == 'move':
+      m = re.match(r'^(.+?)\s+for\s+(.+)$', rest)
+      if not m:
+        raise CompileError('line %d: expected move POS for N' % lineno)
+      lx, ly = parse_stick(m.group(1), constants, lineno)
+      emit(Step(0, lx, ly, duration(m.group(2), constants, lineno), lineno))
+    elif word == 'wait':
+      emit(Step(0, STICK_CENTER, STICK_CENTER, duration(rest, constants, lineno), lineno))
+    else:
+      raise CompileError('line %d: cannot parse "%s"' % (lineno, text))
+  check_closed()
+  unknown = sorted(set(overrides) - declared)
+  if unknown:
+    raise CompileError('-D %s: the script has no const %s' % (unknown[0], unknown[0]))
+  defined = [r for r in routines if not r.extern and not r.native]
+  if not defined:
+    raise CompileError('no routine defined')
+  # The program starts at Routines[0]
+  return defined[:1] + [r for r in routines if r is not defined[0]]
+
+# Encodable durations, up to MAX_DURATION.
+def encodable(d):
+  return d < 128 or (d <= MAX_DURATION and (d - 128) % 4 == 0)
+
+# Splits a step into steps of encodable durations adding up to the same time.
+def split(step):
+  left = step.duration
+  steps = []
+  while True:
+    d = min(left, MAX_DURATION)
+    while not encodable(d):
+      d -= 1
+    steps.append(Step(step.buttons, step.lx, step.ly, d, step.line))
+    left -= d
+    if left == 0:
+      return steps
+
+# Merges adjacent identical steps, then splits durations. A label, or being
+# the instruction a skip may jump over, keeps a step apart from its neighbours.
+def optimize(code):
+  merged = []
+  for item in code:
+    prev = merged[-1] if merged else None
+    guarded = len(merged) >= 2 and isinstance(merged[-2], Op) and merged[-2].name.startswith('SKIP')
+    if isinstance(item, Step) and isinstance(prev, Step) and prev.same_report(item) and not guarded:
+      merged[-1] = Step(prev.buttons, prev.lx, prev.ly,
+                        prev.duration + item.duration, prev.line)
+    elif isinstance(item, Step):
+      merged.append(Step(item.buttons, item.lx, item.ly, item.duration, item.line))
+    else:
+      merged.append(item)
+  out = []
+  for i, item in enumerate(merged):
+    if isinstance(item, Step):
+      pieces = split(item)
+      if len(pieces) > 1 and i > 0 and isinstance(merged[i - 1], Op) and merged[i - 1].name.startswith('SKIP'):
+        raise CompileError('line %d: step after an if is too long to be skipped' % item.line)
+      out.extend(pieces)
+    else:
+      out.append(item)
+  # An if around a single instruction needs no jump: skip it directly
+  i = 0
+  while i + 3 < len(out):
+    skip, jump, body, label = out[i:i + 4]
+    if (isinstance(skip, Op) and skip.name.startswith('SKIP') and
+        isinstance(jump, Op) and jump.name == 'JUMP' and
+        not isinstance(body, Label) and isinstance(label, Label) and
+        jump.target[0] == label.name):
+      negated = 'SKIP_IF_NE' if skip.name == 'SKIP_IF_EQ' else 'SKIP_IF_EQ'
+      out[i:i + 2] = [Op(negated, skip.args, skip.line)]
+    i += 1
+  return out
+
+# Lays routines out, resolving calls and jumps.
+def link(routines):
+  index = dict((r.name, i) for i, r in enumerate(routines))
+  for r in routines:
+    if r.extern or r.native:
+      continue
+    code = optimize(r.code)
+    last = [c for c in code if not isinstance(c, Label)][-1:] or [None]
+    if not (isinstance(last[0], Op) and last[0].name in ('RET', 'END', 'JUMP')):
+      code.append(Op('RET', [], r.line))
+    offsets, labels, at = [], {}, 0
+    for item in code:
+      offsets.append(at)
+      if isinstance(item, Label):
+        if item.name in labels:
+          raise CompileError('line %d: label %s defined twice' % (item.line, item.name))
+        labels[item.name] = (at, item.loops)
+      else:
+        at += item.length()
+    for item, offset in zip(code, offsets):
+      if isinstance(item, Op) and item.name == 'CALL':
+        if item.target not in index:
+          raise CompileError('line %d: unknown routine %s' % (item.line, item.target))
+        callee = routines[index[item.target]]
+        # A native is called in place, for as many reports as it takes
+        if callee.native:
+          item.name = 'NATIVE'
+        item.args = [callee.enum()]
+      elif isinstance(item, Op) and item.name == 'JUMP':
+        name, loops = item.target
+        if name not in labels:
+          raise CompileError('line %d: unknown label %s' % (item.line, name))
+        if labels[name][1] != loops:
+          raise CompileError('line %d: goto %s enters or leaves a loop' % (item.line, name))
+        item.args = [labels[name][0] - (offset + item.length())]
+    r.code = [c for c in code if not isinstance(c, Label)]
+    r.size = at
+  check_ops(routines)
+  return routines
+
+# Checks that no run of control operations between two steps is longer than
+# MAX_OPS, following every path from the start, from each step, and from
+# each native, which counts as a step: both ways at a skip, and around or
+# out of a loop whose count isn't known, as it isn't for a loop opened
+# before the step, or on a register. A RET out of a routine entered before
+# the step goes back to every call of it. Extern routines, such as
+# SyncController, are taken to start and end with a step.
+def check_ops(routines):
+  byname = dict((r.enum(), r) for r in routines)
+  callers = dict((r.enum(), []) for r in routines)
+  nexts, ends = {}, {}
+  for r in routines:
+    if r.extern or r.native:
+      continue
+    offsets = [0]
+    for item in r.code:
+      offsets.append(offsets[-1] + item.length())
+    r.at = dict((offset, i) for i, offset in enumerate(offsets))
+    opened = []
+    for i, item in enumerate(r.code):
+      if isinstance(item, Op) and item.name in ('LOOP', 'LOOP_REG', 'FOREVER'):
+        opened.append(i)
+      elif isinstance(item, Op) and item.name == 'NEXT' and opened:
+        nexts[(r.enum(), i)] = opened[-1]
+        ends[(r.enum(), opened.pop())] = i + 1
+      elif isinstance(item, Op) and item.name in ('CALL', 'NATIVE'):
+        callers[item.args[0]].append((r, i))
+
+  # Runs from instruction i of r, `ops` operations in, with `stack` the
+  # frames pushed since the run started: ('call', routine, i) or ('loop',
+  # routine, i, count), count None if unknown and 0 forever. `rooted` if the
+  # run started with the stack empty.
+  def run(start, r, i, ops, stack, rooted):
+    while True:
+      item = r.code[i] if i < len(r.code) else Op('END', [], r.line)
+      if isinstance(item, Op) and item.name == 'END':
+        return
+      if ops == MAX_OPS:
+        raise CompileError('line %d: more than %d control operations in a row from here, '
+                           'without a step in between' % (start.line, MAX_OPS))
+      if isinstance(item, Step):
+        return
+      name = item.name
+      ops += 1
+      if name == 'CALL':
+        callee = byname[item.args[0]]
+        if callee.extern:
+          return
+        r, i, stack = callee, 0, stack + (('call', r, i + 1),)
+      elif name == 'NATIVE':
+        return
+      elif name == 'RET':
+        if stack:
+          _, r, i = stack[-1]
+          stack = stack[:-1]
+        else:
+          if not rooted:
+            for caller, at in callers[r.enum()]:
+              run(start, caller, at + 1, ops, (), False)
+          return
+      elif name in ('LOOP', 'LOOP_REG', 'FOREVER'):
+        count = item.args[0] if name == 'LOOP' else 0 if name == 'FOREVER' else None
+        if count is None:
+          run(start, r, ends[(r.enum(), i)], ops, stack, rooted)
+        if count == 0 and name == 'LOOP':
+          i = ends[(r.enum(), i)]
+        else:
+          stack, i = stack + (('loop', r, i + 1, count),), i + 1
+      elif name == 'NEXT':
+        if stack and stack[-1][0] != 'loop':
+          return
+        if stack:
+          _, _, body, count = stack[-1]
+          if count is None:
+            run(start, r, i + 1, ops, stack[:-1], rooted)
+            i = body
+          elif count == 0 or count > 1:
+            stack, i = stack[:-1] + (('loop', r, body, count and count - 1),), body
+          else:
+            stack, i = stack[:-1], i + 1
+        elif rooted or (r.enum(), i) not in nexts:
+          return
+        else:
+          opener = nexts[(r.enum(), i)]
+          if r.code[opener].name != 'FOREVER':
+            run(start, r, i + 1, ops, stack, rooted)
+          i = opener + 1
+      elif name.startswith('SKIP'):
+        run(start, r, i + 1, ops, stack, rooted)
+        i += 2
+      elif name == 'JUMP':
+        i = r.at[sum(c.length() for c in r.code[:i + 1]) + item.args[0]]
+      else:
+        i += 1
+
+  for r in routines:
+    if r.extern or r.native:
+      continue
+    if r is routines[0]:
+      run(r.code[0], r, 0, 0, (), True)
+    for i, item in enumerate(r.code):
+      if isinstance(item, Step) and i + 1 < len(r.code):
+        run(r.code[i + 1], r, i + 1, 0, (), False)
+      elif isinstance(item, Op) and (item.name == 'NATIVE' or
+                                     (item.name == 'CALL' and byname[item.args[0]].extern)):
+        # A native resumes on its NATIVE, an extern routine leaves on its RET
+        run(item, r, i + 1, 1, (), False)
+
+def generate(routines, source_name):
+  natives = [r for r in routines if r.native]
+  routines = [r for r in routines if not r.native]
+  out = ['/*', '  Generated by mac2c.py from %s. Do not edit; edit the .mac file and' % source_name,
+         '  run "python mac2c.py %s" again.' % source_name, '*/', '', 'enum {']
+  out += ['  %s,' % r.enum() for r in routines]
+  out += ['};', '']
+  if natives:
+    out.append('enum {')
+    out += ['  %s,' % r.enum() for r in natives]
+    out += ['};', '']
+    out += ['uint16_t %s(USB_JoystickReport_Input_t* const ReportData, bool starting);' % r.c_name() for r in natives]
+    out.append('')
+  for r in routines:
+    if r.extern:
+      continue
+    out.append('// %d bytes' % r.size)
+    out.append('const Step_t %s[] PROGMEM = {' % r.c_name())
+    out += ['  %s,' % c.c() for c in r.code]
+    out += ['};', '']
+  out.append('const Step_t* const Routines[] PROGMEM = {')
+  out += ['  [%s] = %s,' % (r.enum(), r.c_name()) for r in routines]
+  out.append('};')
+  if natives:
+    out += ['', 'const Native_t Natives[] PROGMEM = {']
+    out += ['  [%s] = %s,' % (r.enum(), r.c_name()) for r in natives]
+    out.append('};')
+  return '\n'.join(out) + '\n'
+
+# The program as an image for upload: the header, then the offset of each
+# routine in what follows it, then the routines. SyncController is the only
+# C routine there is: the firmware's natives are its own script's, so an
+# uploaded script can't have any.
+def image(routines):
+  for r in routines:
+    if r.native:
+      raise CompileError('line %d: an uploaded script cannot call natives' % r.line)
+  index = dict((r.enum(), i) for i, r in enumerate(routines))
+  table, code = [], []
+  for r in routines:
+    if r.extern and r.extern != 'SyncController':
+      raise CompileError('line %d: an uploaded script can only call SyncController from C' % r.line)
+    offset = UPLOAD_SYNC if r.extern else 2 * len(routines) + len(code)
+    table += [offset & 0xFF, offset >> 8]
+    if not r.extern:
+      code += sum((c.encode(index) for c in r.code), [])
+  program = table + code
+  crc = imagec.crc16(program)
+  header = list(bytearray(UPLOAD_MAGIC)) + [len(program) & 0xFF, len(program) >> 8,
+                                            len(routines), UPLOAD_VERSION, crc & 0xFF, crc >> 8]
+  return bytearray(header + program)
+
+# -D options, as consts.
+def overrides(opts):
+  values = {}
+  for opt, arg in opts:
+    if opt == '-D':
+      m = re.match(r'^(\w+)=(.+)$', arg)
+      if not m:
+        raise CompileError('expected -D NAME=value, not %s' % arg)
+      values[m.group(1)] = evaluate(m.group(2), {}, 0)
+  return values
+
+def main(argv):
+  opts, args = getopt.getopt(argv, "ho:D:")
+  output = None
+  for opt, arg in opts:
+    if opt == '-h':
+      usage()
+      sys.exit()
+    elif opt == '-o':
+      output = arg
+  if len(args) != 1:
+    usage()
+    sys.exit(1)
+
+  source = args[0]
+  if output is None:
+    output = os.path.splitext(source)[0] + '_script.h'
+  try:
+    routines = link(parse(open(source).read(), overrides(opts)))
+  except CompileError as e:
+    print("{}: {}".format(source, e))
+    sys.exit(1)
+
+  with open(output, 'w') as f:
+    f.write(generate(routines, os.path.basename(source)))
+  size = sum(r.size for r in routines if not r.extern and not r.native)
+  print("{} compiled to {} ({} bytes of program)".format(source, output, size))
+
+def usage():
+  print("To compile a script: mac2c.py yourScript.mac")
+  print("To choose the output header: mac2c.py -o header.h yourScript.mac")
+  print("With a const set otherwise: mac2c.py -D PAGES=4 yourScript.mac")
+
+if __name__ == "__main__":
+  if len(sys.argv[1:]) == 0:
+    usage()
+    sys.exit
+  else:
+    main(sys.argv[1:])
@@ -0,0 +1,341 @@
+#!/bin/python
+
+# Plans how the printer inks an image: instead of sweeping the canvas, the
+# cursor goes from pixel to pixel in the order that takes the fewest D-pad
+# presses, and the plan is compiled into a header the printer includes in
+# place of the bitmap (make with-plan, in printer/).
+#
+#   plan.py [-o plan.h] [-t ticks] [-r rows] [-p previous/image.c]
+#           [-s pens] image.c
+#
+# With -p, the plan only changes the canvas from the image printed before,
+# read from that image.c and the image.h next to it, to this one: it erases
+# the pixels that go white with B, then inks the ones that go black, and the
+# printer leaves the canvas as it is rather than clearing it first
+# (make with-delta, in printer/).
+#
+# -s gives the sizes of the game's pens, smallest first, as the side of the
+# square each inks around the cursor, e.g. 1,3,7: solid areas are then filled
+# with the biggest pen whose square fits inside them, where it does at least
+# half of its pixels still to do, and a finer pen does the edges and details
+# (make with-pens, in printer/). L and R change pens, one size at a time.
+#
+# A move of one pixel, straight or diagonal, costs a press and a release, and
+# so does inking a pixel; travel between pixels takes as many moves as the
+# longer of its two axes. The order is a nearest neighbour tour that keeps
+# going in a straight line while it can, preferring the direction with the
+# longest run of pixels ahead. The plan is made of:
+#
+#   PLAN_TRAVEL(x, y)      moves to (x, y), diagonally first, and inks it
+#   PLAN_INK(hat, count)   moves and inks `count` times in a D-pad direction
+#   PLAN_TOOL(tool)        inks with TOOL_PEN (A) or TOOL_ERASER (B), and
+#                          the pen TOOL_SIZE(n), from then on; TOOL_PEN
+#                          and the smallest pen to start with
+#   PLAN_END
+#
+# -t sets how long each press or release lasts, in engine ticks (PRINT_TICKS,
+# 1 by default), for the time estimate, and -r how often the printer homes
+# the cursor again (REHOME_ROWS), to count what that costs: it holds the
+# stick for HOME_TICKS, then moves back from the corner.
+
+import sys, os, bisect, getopt
+
+import imagec
+
+WIDTH, HEIGHT = imagec.CANVAS_WIDTH, imagec.CANVAS_HEIGHT
+TICK_MS = 8
+HOME_TICKS = 300
+BUTTON_TICKS = 10
+MAX_RUN = 2047
+
+# D-pad directions, by (dx, dy), as in Engine.h.
+HATS = {
+  (0, -1): 'HAT_TOP', (1, -1): 'HAT_TOP_RIGHT', (1, 0): 'HAT_RIGHT',
+  (1, 1): 'HAT_BOTTOM_RIGHT', (0, 1): 'HAT_BOTTOM', (-1, 1): 'HAT_BOTTOM_LEFT',
+  (-1, 0): 'HAT_LEFT', (-1, -1): 'HAT_TOP_LEFT',
+}
+# Their values, as in Engine.h.
+HAT_CODES = ['HAT_TOP', 'HAT_TOP_RIGHT', 'HAT_RIGHT', 'HAT_BOTTOM_RIGHT', 'HAT_BOTTOM',
+             'HAT_BOTTOM_LEFT', 'HAT_LEFT', 'HAT_TOP_LEFT']
+# Straight directions first, for ties.
+DIRECTIONS = [(1, 0), (-1, 0), (0, 1), (0, -1), (1, 1), (-1, 1), (1, -1), (-1, -1)]
+
+# Reads the set pixels of image.c, and image.h next to it, in canvas
+# coordinates.
+def read_image(path):
+  rows, x0, y0 = imagec.read(os.path.dirname(path) or '.')
+  return set((x0 + x, y0 + y) for y, row in enumerate(rows) for x, v in enumerate(row) if v)
+
+# The pixels a pen `size` pixels across inks with the cursor at `c`.
+def square(c, size):
+  half = size // 2
+  return [(c[0] + dx, c[1] + dy) for dy in range(-half, size - half) for dx in range(-half, size - half)]
+
+# Where to put each pen down to change the pixels of `target`, with squares
+# only covering pixels of `allowed`, the ones that end up the colour inked.
+# Bigger pens go first, in reading order, wherever their square does at
+# least half of its pixels still to do; the smallest does the rest. Returns
+# the places for each pen.
+def stamps(target, allowed, pens):
+  left = set(target)
+  places = [[] for _ in pens]
+  # Allowed pixels in the rectangle from (0, 0) to each, for testing squares
+  sums = [[0] * (WIDTH + 1) for _ in range(HEIGHT + 1)]
+  for y in range(HEIGHT if len(pens) > 1 else 0):
+    for x in range(WIDTH):
+      sums[y + 1][x + 1] = sums[y][x + 1] + sums[y + 1][x] - sums[y][x] + ((x, y) in allowed)
+  for i in range(len(pens) - 1, 0, -1):
+    size, half = pens[i], pens[i] // 2
+    need = (size * size + 1) // 2
+    for y in range(half, HEIGHT - size + half + 1):
+      for x in range(half, WIDTH - size + half + 1):
+        x0, y0 = x - half, y - half
+        if sums[y0 + size][x0 + size] - sums[y0][x0 + size] - sums[y0 + size][x0] + sums[y0][x0] != size * size:
+          continue
+        covered = [p for p in square((x, y), size) if p in left]
+        if len(covered) >= need:
+          places[i].append((x, y))
+          left.difference_update(covered)
+  places[0] = sorted(left)
+  return places
+
+def distance(a, b):
+  return max(abs(a[0] - b[0]), abs(a[1] - b[1]))
+
+# The pixels left, by row, for finding the nearest one quickly.
+class Pixels(object):
+  def __init__(self, pixels):
+    self.left = set(pixels)
+    self.rows = [sorted(x for x, y in pixels if y == row) for row in range(HEIGHT)]
+
+  def remove(self, p):
+    self.left.remove(p)
+    row = self.rows[p[1]]
+    del row[bisect.bisect_left(row, p[0])]
+
+  def run(self, p, d):
+    n = 0
+    while (p[0] + d[0] * (n + 1), p[1] + d[1] * (n + 1)) in self.left:
+      n += 1
+    return n
+
+  def nearest(self, p):
+    best = None
+    for dy in range(HEIGHT):
+      if best and dy > distance(p, best):
+        break
+      for y in sorted(set([p[1] - dy, p[1] + dy])):
+        if not 0 <= y < HEIGHT or not self.rows[y]:
+          continue
+        row = self.rows[y]
+        i = bisect.bisect_left(row, p[0])
+        for x in row[max(i - 1, 0):i + 1]:
+          if best is None or distance(p, (x, y)) < distance(p, best):
+            best = (x, y)
+    return best
+
+# Orders the pixels into a tour from `at`, the top-left corner by default.
+def tour(pixels, at=(0, 0)):
+  left = Pixels(pixels)
+  d = None
+  order = []
+  while left.left:
+    ahead = (at[0] + d[0], at[1] + d[1]) if d else None
+    if ahead not in left.left:
+      runs = [(left.run(at, e), -i, e) for i, e in enumerate(DIRECTIONS)]
+      best = max(runs)
+      if best[0]:
+        d = best[2]
+        ahead = (at[0] + d[0], at[1] + d[1])
+      else:
+        d = None
+        ahead = left.nearest(at)
+    left.remove(ahead)
+    order.append(ahead)
+    at = ahead
+  return order
+
+# Encodes a tour from `at` into plan records: ('TRAVEL', x, y) and
+# ('INK', (dx, dy), n).
+def encode(order, at=(0, 0)):
+  records = []
+  for p in order:
+    d = (p[0] - at[0], p[1] - at[1])
+    last = records[-1] if records else None
+    if distance(p, at) == 1 and last and last[0] == 'INK' and last[1] == d and last[2] < MAX_RUN:
+      records[-1] = ('INK', d, last[2] + 1)
+    elif distance(p, at) == 1:
+      records.append(('INK', d, 1))
+    else:
+      records.append(('TRAVEL', p[0], p[1]))
+    at = p
+  return records
+
+# D-pad moves, inks and homings of a tour, and of the printer's row sweeps,
+# homing the cursor as the printer does every `rehome` rows: before a sweep,
+# or before travelling once it made as many moves as that many rows across.
+def tour_cost(order, rehome=0):
+  at, moves, since, homes = (0, 0), 0, 0, 0
+  for p in order:
+    if rehome and distance(at, p) != 1 and since >= rehome * WIDTH:
+      at, since, homes = (0, 0), 0, homes + 1
+    moves += distance(at, p)
+    since += distance(at, p)
+    at = p
+  return moves, len(order), homes
+
+def sweep_cost(pixels, rehome=0):
+  x, y, moves, homes, homed = 0, 0, 0, 0, None
+  for row in range(HEIGHT):
+    xs = [px for px, py in pixels if py == row]
+    if not xs:
+      continue
+    if homed is None:
+      homed = row
+    elif rehome and row >= homed + rehome:
+      x, y, homes, homed = 0, 0, homes + 1, row
+    first, last = min(xs), max(xs)
+    start, end = (first, last) if x <= first or x - first <= last - x else (last, first)
+    moves += (row - y) + abs(start - x) + abs(end - start)
+    x, y = end, row
+  return moves, len(pixels), homes
+
+# Plans passes of (eraser, pen, places), each a tour from where the last
+# one ended. Returns the records and the places in order.
+def plan_passes(passes):
+  records, order, at, tool = [], [], (0, 0), (False, 0)
+  for eraser, pen, places in passes:
+    if not places:
+      continue
+    if (eraser, pen) != tool:
+      records.append(('TOOL', eraser, pen))
+      tool = (eraser, pen)
+    o = tour(places, at)
+    records += encode(o, at)
+    order += o
+    at = o[-1]
+  return records, order
+
+# L and R presses changing pens, starting with all the L presses it takes to
+# get to the smallest one from any of them.
+def pen_presses(records, pens):
+  presses, pen = len(pens) - 1, 0
+  for r in records:
+    if r[0] == 'TOOL':
+      presses += abs(r[2] - pen)
+      pen = r[2]
+  return presses
+
+def record_c(r):
+  if r[0] == 'TRAVEL':
+    return 'PLAN_TRAVEL(%d, %d)' % (r[1], r[2])
+  if r[0] == 'TOOL':
+    tool = 'TOOL_ERASER' if r[1] else 'TOOL_PEN'
+    return 'PLAN_TOOL(%s | TOOL_SIZE(%d))' % (tool, r[2]) if r[2] else 'PLAN_TOOL(%s)' % tool
+  return 'PLAN_INK(%s, %d)' % (HATS[r[1]], r[2])
+
+def record_size(r):
+  return {'TRAVEL': 3, 'INK': 2, 'TOOL': 1}[r[0]]
+
+# The bytes of the records, as printer.h encodes them, to identify the plan.
+def record_bytes(r):
+  if r[0] == 'TRAVEL':
+    return [0x40 | r[1] >> 8, r[1] & 0xff, r[2]]
+  if r[0] == 'TOOL':
+    return [0x20 | r[1] | r[2] << 1]
+  hat = HAT_CODES.index(HATS[r[1]])
+  return [0x80 | hat << 3 | r[2] >> 8, r[2] & 0xff]
+
+def generate(records, source_name, previous, pens):
+  ident = imagec.crc16(sum((record_bytes(r) for r in records), []))
+  command = ('-p %s ' % previous if previous else '') + ('-s %s ' % ','.join(map(str, pens)) if len(pens) > 1 else '') + source_name
+  out = ['/*', '  Generated by plan.py from %s. Do not edit; run "python plan.py %s"' % (source_name, command),
+         '  again after changing the image.', '*/', '',
+         '// Identifies the plan, so that a print is only resumed with the plan it',
+         '// was started with.', '#define PLAN_ID 0x%04x' % ident, '']
+  if previous:
+    out += ['// The plan changes the image printed before: the canvas is not cleared.', '#define PLAN_DELTA', '']
+  if len(pens) > 1:
+    out += ['// How many pens the game has, for the printer to start with the smallest.',
+            '#define PLAN_PENS %d' % len(pens), '']
+  out.append('const uint8_t PrintPlan[] PROGMEM = {')
+  for i in range(0, len(records), 6):
+    out.append('  ' + ' '.join(record_c(r) + ',' for r in records[i:i + 6]))
+  out += ['  PLAN_END', '};']
+  return '\n'.join(out) + '\n'
+
+def main(argv):
+  opts, args = getopt.getopt(argv, "ho:t:r:p:s:")
+  output = 'plan.h'
+  ticks = 1
+  rehome = 0
+  previous = None
+  pens = [1]
+  for opt, arg in opts:
+    if opt == '-h':
+      usage()
+      sys.exit()
+    elif opt == '-o':
+      output = arg
+    elif opt == '-t':
+      ticks = int(arg)
+    elif opt == '-r':
+      rehome = int(arg)
+    elif opt == '-p':
+      previous = arg
+    elif opt == '-s':
+      pens = [int(n) for n in arg.split(',')]
+  if len(args) != 1:
+    usage()
+    sys.exit(1)
+
+  if len(pens) > 4 or pens[0] != 1 or pens != sorted(pens):
+    print("ERROR: pens go from 1 pixel up, and there are 4 at most!")
+    sys.exit(1)
+
+  pixels = read_image(args[0])
+  canvas = set((x, y) for y in range(HEIGHT) for x in range(WIDTH))
+  erase, ink = set(), pixels
+  if previous:
+    old = read_image(previous)
+    erase, ink = old - pixels, pixels - old
+  # Erase, then ink, biggest pens first
+  passes = [(True, i, p) for i, p in reversed(list(enumerate(stamps(erase, canvas - pixels, pens))))]
+  passes += [(False, i, p) for i, p in reversed(list(enumerate(stamps(ink, pixels, pens))))]
+  records, order = plan_passes(passes)
+  with open(output, 'w') as f:
+    f.write(generate(records, os.path.basename(args[0]), previous, pens))
+
+  press = 2 * ticks * TICK_MS / 1000.0
+  home = (HOME_TICKS + ticks) * TICK_MS / 1000.0
+  pen = (BUTTON_TICKS + ticks) * TICK_MS / 1000.0
+  size = sum(record_size(r) for r in records) + 1
+  print("{} planned into {}: {} pixels, {} records, {} bytes".format(args[0], output, len(pixels), len(records), size))
+  if previous:
+    print("  changes from {}: {} pixels to erase, {} to ink".format(previous, len(erase), len(ink)))
+  presses = pen_presses(records, pens) if len(pens) > 1 else 0
+  if presses:
+    print("  pens {}: {} places, {} presses changing pens".format(
+      ', '.join('{}x{} {}'.format(n, n, sum(len(r[2]) for r in passes if r[1] == i)) for i, n in enumerate(pens)),
+      len(order), presses))
+  for name, (moves, inks, homes), changes in (('plan', tour_cost(order, rehome), presses),
+                                              ('sweeps', sweep_cost(pixels, rehome), 0)):
+    line = "  {:<8} {:6d} moves {:6d} inks {:9.1f} s".format(name, moves, inks,
+                                                            (moves + inks) * press + homes * home + changes * pen)
+    if rehome:
+      line += ", homing {} times, {:.1f} s more".format(homes, homes * home + (moves - (tour_cost(order) if name == 'plan' else sweep_cost(pixels))[0]) * press)
+    print(line)
+
+def usage():
+  print("To plan the printing of image.c: plan.py image.c")
+  print("To choose the output header: plan.py -o plan.h image.c")
+  print("To count homing the cursor every 16 rows: plan.py -r 16 image.c")
+  print("To only print what changed since old/image.c: plan.py -p old/image.c image.c")
+  print("To fill solid areas with pens 3 and 7 pixels across: plan.py -s 1,3,7 image.c")
+
+if __name__ == "__main__":
+  if len(sys.argv[1:]) == 0:
+    usage()
+    sys.exit
+  else:
+    main(sys.argv[1:])
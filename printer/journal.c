@@ -0,0 +1,154 @@
+/** \file
+ *
+ *  Journal of the printer's progress in EEPROM, for a print to go on where it
+ *  was after a reset or after the console lost the controller.
+ *
+ *  Entries go round a ring of JOURNAL_SLOTS slots, each numbered one more
+ *  than the last, 0 to 254: the newest one is the one the next slot doesn't
+ *  follow. An entry's number is written last, in a single byte, after its
+ *  number was set to 0xFF, so a slot that was being written when the power
+ *  went is never taken for an entry; a check byte catches a number only half
+ *  written. Bytes are written one at a time by JournalTask(), each taking a
+ *  few milliseconds of the EEPROM's time but none of the CPU's.
+ */
+
+#include <stddef.h>
+#include <avr/eeprom.h>
+
+#include "journal.h"
+
+typedef struct {
+	uint16_t id;
+	uint16_t progress;
+	uint8_t check;
+	uint8_t seq;
+} JournalEntry_t;
+
+// The number of a slot being written, or never written.
+#define SEQ_NONE 0xFF
+// The steps of an entry's write, a byte each, and the step when there's none
+// going on.
+#define WRITE_STEPS (sizeof(JournalEntry_t) + 1)
+#define WRITE_IDLE  0xFF
+
+static JournalEntry_t Journal[JOURNAL_SLOTS] EEMEM;
+
+// Whether the ring was read, the slot and number of the next entry, and
+// whether there's an entry before it.
+static bool opened = false;
+static uint8_t slot;
+static uint8_t seq;
+static bool found;
+
+// The last entry given to the EEPROM, the progress to journal next if it's
+// different, when the last write started, and the entry being written and
+// which of its bytes is next.
+static JournalEntry_t last;
+static JournalEntry_t wanted;
+static bool dirty = false;
+static uint32_t written_at;
+static JournalEntry_t entry;
+static uint8_t step = WRITE_IDLE;
+
+static uint8_t Check(const JournalEntry_t* e) {
+	return 0xA5 + (e->id & 0xFF) + (e->id >> 8) + (e->progress & 0xFF) + (e->progress >> 8) + e->seq;
+}
+
+static uint8_t NextSeq(uint8_t s) {
+	return s == SEQ_NONE - 1 ? 0 : s + 1;
+}
+
+// Reads slot i, returning whether it holds an entry.
+static bool ReadEntry(uint8_t i, JournalEntry_t* e) {
+	eeprom_read_block(e, &Journal[i], sizeof(JournalEntry_t));
+	return e->seq != SEQ_NONE && e->check == Check(e);
+}
+
+// Finds the newest entry.
+static void Open(void) {
+	JournalEntry_t following;
+	uint8_t i;
+
+	opened = true;
+	slot = 0;
+	seq = 0;
+	found = false;
+	for (i = 0; i < JOURNAL_SLOTS; i++)
+	{
+		if (!ReadEntry(i, &last))
+			continue;
+		if (ReadEntry((i + 1) % JOURNAL_SLOTS, &following) && following.seq == NextSeq(last.seq))
+			continue;
+		slot = (i + 1) % JOURNAL_SLOTS;
+		seq = NextSeq(last.seq);
+		found = true;
+		return;
+	}
+}
+
+uint16_t JournalRead(uint16_t id) {
+	if (!opened)
+		Open();
+	return found && last.id == id ? last.progress : 0;
+}
+
+void JournalWrite(uint16_t id, uint16_t progress) {
+	if (!opened)
+		Open();
+	wanted.id = id;
+	wanted.progress = progress;
+	dirty = !found || last.id != id || last.progress != progress;
+}
+
+// Starts writing the progress wanted into the next slot.
+static void StartWrite(void) {
+	entry = wanted;
+	entry.seq = seq;
+	entry.check = Check(&entry);
+	last = entry;
+	found = true;
+	dirty = false;
+	written_at = Millis();
+	step = 0;
+}
+
+// Writes the next byte of the entry: its number to SEQ_NONE first, the rest
+// of it, and its number last.
+static void WriteByte(void) {
+	uint8_t* at = (uint8_t*)&Journal[slot];
+
+	if (step == 0)
+		eeprom_update_byte(at + offsetof(JournalEntry_t, seq), SEQ_NONE);
+	else if (step <= offsetof(JournalEntry_t, seq))
+		eeprom_update_byte(at + step - 1, ((const uint8_t*)&entry)[step - 1]);
+	else
+		eeprom_update_byte(at + offsetof(JournalEntry_t, seq), entry.seq);
+
+	if (++step == WRITE_STEPS)
+	{
+		step = WRITE_IDLE;
+		slot = (slot + 1) % JOURNAL_SLOTS;
+		seq = NextSeq(seq);
+	}
+}
+
+void JournalTask(void) {
+	if (step != WRITE_IDLE)
+	{
+		if (eeprom_is_ready())
+			WriteByte();
+	}
+	else if (dirty && (int32_t)(Millis() - written_at) >= JOURNAL_MS)
+	{
+		StartWrite();
+	}
+}
+
+void JournalFlush(void) {
+	while (step != WRITE_IDLE || dirty)
+	{
+		if (step == WRITE_IDLE)
+			StartWrite();
+		WriteByte();
+	}
+}
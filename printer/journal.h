@@ -0,0 +1,37 @@
+/** \file
+ *
+ *  Header file for journal.c.
+ */
+
+#ifndef _JOURNAL_H_
+#define _JOURNAL_H_
+
+/* Includes: */
+#include "../Engine.h"
+
+/* Macros: */
+// Entries in the EEPROM ring. Each is written to the slot after the last, so
+// that each slot wears out this many times slower.
+#ifndef JOURNAL_SLOTS
+#define JOURNAL_SLOTS 32
+#endif
+
+// How often, at most, progress is written, in Milliseconds.
+#ifndef JOURNAL_MS
+#define JOURNAL_MS 2000
+#endif
+
+/* Function Prototypes: */
+// Returns the progress journaled last for the print `id`, or 0 if there's
+// none, or it's for another one.
+uint16_t JournalRead(uint16_t id);
+// Journals progress of the print `id`. It's only written by JournalTask(),
+// JOURNAL_MS after the last write, so only the latest is kept until then.
+void JournalWrite(uint16_t id, uint16_t progress);
+// Writes a byte of the journal entry in progress if the EEPROM is ready for
+// it, without waiting. Call it often.
+void JournalTask(void);
+// Writes the progress journaled, waiting for the EEPROM.
+void JournalFlush(void);
+
+#endif
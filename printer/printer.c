@@ -0,0 +1,566 @@
+/*
+Nintendo Switch Fightstick - Proof-of-Concept
+
+Based on the LUFA library's Low-Level Joystick Demo
+	(C) Dean Camera
+Based on the HORI's Pokken Tournament Pro Pad design
+	(C) HORI
+
+This project implements a modified version of HORI's Pokken Tournament Pro Pad
+USB descriptors to allow for the creation of custom controllers for the
+Nintendo Switch. This also works to a limited degree on the PS3.
+
+Since System Update v3.0.0, the Nintendo Switch recognizes the Pokken
+Tournament Pro Pad as a Pro Controller. Physical design limitations prevent
+the Pokken Controller from functioning at the same level as the Pro
+Controller. However, by default most of the descriptors are there, with the
+exception of Home and Capture. Descriptor modification allows us to unlock
+these buttons for our use.
+*/
+
+/** \file
+ *
+ *  Main source file for the Splatoon post printer. The program in printer.mac
+ *  syncs and homes the cursor; PrintImage, a native, then clears the canvas
+ *  and inks the image one pixel at a time with A, moving with the D-pad.
+ *
+ *  By default it sweeps the image one row at a time and presses A on every
+ *  pixel set in image_data. Each sweep only covers the row's set pixels, from
+ *  the end nearer the cursor, and blank rows are skipped, using image_rows.
+ *  The image's size and place on the canvas come from ../image.h, so a stamp
+ *  smaller than the canvas takes as much less time and flash.
+ *  Built with IMAGE_RLE, it reads image_runs instead, decoding each row as
+ *  it gets to it. Built with PRINT_PLAN, it follows PrintPlan instead, the
+ *  order planned by ../plan.py, with diagonal moves. A plan made from the
+ *  image printed before only changes what's different, erasing with B, and
+ *  leaves the rest of the canvas as it is. A plan may also fill solid areas
+ *  with bigger pens, changing pens with L and R.
+ *
+ *  Progress is journaled to EEPROM by journal.c: the row about to be swept,
+ *  or the plan's record travelling to the next pixel. Printing the same image
+ *  after a reset, or after the program restarted because the console lost the
+ *  controller, goes on from there without clearing the canvas. Built with
+ *  PRINT_FRESH, it starts over every time.
+ *
+ *  Built with REHOME_ROWS, it homes the cursor again every so many rows, then
+ *  goes back to where it was, so that a D-pad report the console missed only
+ *  shifts the pixels up to there rather than all the rest of the print.
+ */
+
+#include "printer.h"
+#include "journal.h"
+
+#include "printer_script.h"
+
+#ifdef PRINT_DELTA
+#include "delta.h"
+#elif defined(PRINT_PENS)
+#include "pens.h"
+#elif defined(PRINT_PLAN)
+#include "plan.h"
+#endif
+
+// Where PrintImage is: clearing the canvas, then in a pixel: inking it,
+// releasing A, moving on to the next one, releasing the D-pad.
+typedef enum {
+	START,
+	CLEAR,
+	INK,
+	INK_RELEASE,
+	MOVE,
+	MOVE_RELEASE,
+	DONE,
+} PrintStage_t;
+
+// What NextMove() gives when the cursor is to be homed rather than moved,
+// or a button pressed to change pens.
+#define HAT_HOME 0xFF
+#define HAT_PEN  0xFE
+
+static uint16_t xpos = 0;
+static uint8_t ypos = 0;
+static PrintStage_t stage = START;
+// Whether the cursor is on its way back from being homed again.
+static bool returning = false;
+// The button inking a pixel: A for the pen, B for the eraser. And the one
+// changing pens, with HAT_PEN.
+static uint16_t ink_button = SWITCH_A;
+static uint16_t pen_button;
+
+#ifdef ALERT_WHEN_DONE
+static uint8_t portsval = 0;
+#endif
+
+#ifdef PRINT_PLAN
+// The next record of the plan, the pixel being travelled to or the pixels
+// left in the current run and their direction, and whether the cursor is on
+// a pixel to ink.
+static const uint8_t* plan;
+static uint16_t target_x;
+static uint8_t target_y;
+static bool travelling;
+static uint16_t run;
+static uint8_t run_hat;
+static bool ink_here;
+// D-pad moves since the cursor was homed.
+static uint32_t moves;
+// The size of the pen in use, and of the one the plan wants.
+static uint8_t pen;
+static uint8_t pen_target;
+
+// D-pad directions by step on each axis, and back.
+static const uint8_t Hats[3][3] PROGMEM = {
+	{HAT_TOP_LEFT,    HAT_TOP,    HAT_TOP_RIGHT},
+	{HAT_LEFT,        HAT_CENTER, HAT_RIGHT},
+	{HAT_BOTTOM_LEFT, HAT_BOTTOM, HAT_BOTTOM_RIGHT},
+};
+static const int8_t HatX[8] PROGMEM = {0, 1, 1, 1, 0, -1, -1, -1};
+static const int8_t HatY[8] PROGMEM = {-1, -1, 0, 1, 1, 1, 0, -1};
+
+// What the journal's progress is for: records of the plan.
+#define PRINT_ID PLAN_ID
+
+static void SetTool(uint8_t tool) {
+	ink_button = (tool & TOOL_ERASER) ? SWITCH_B : SWITCH_A;
+	pen_target = tool >> 1;
+}
+
+// Starts on the record at `from`, with the tool the records before it left.
+// The pen could be any size then, after a restart: going down from the
+// biggest gets to the smallest from any of them.
+static bool StartPrint(uint16_t from) {
+	#ifdef PLAN_PENS
+	pen = PLAN_PENS - 1;
+	#else
+	pen = 0;
+	#endif
+	SetTool(TOOL_PEN);
+	for (plan = PrintPlan; plan < PrintPlan + from; )
+	{
+		uint8_t head = pgm_read_byte(plan);
+
+		if (head & 0x80)
+			plan += 2;
+		else if (head & 0x40)
+			plan += 3;
+		else
+		{
+			SetTool(head & 0x1F);
+			plan++;
+		}
+	}
+	travelling = false;
+	run = 0;
+	ink_here = false;
+	moves = 0;
+	return true;
+}
+
+static bool InkHere(void) {
+	bool ink = ink_here;
+
+	ink_here = false;
+	return ink;
+}
+
+// Changes pens one size at a time until it's the one the plan wants.
+// Returns false once it is.
+static bool ChangePen(uint8_t* hat) {
+	if (pen == pen_target)
+		return false;
+	pen_button = pen < pen_target ? SWITCH_R : SWITCH_L;
+	pen += pen < pen_target ? 1 : -1;
+	*hat = HAT_PEN;
+	return true;
+}
+
+// Moves the cursor one pixel along the plan, or not at all when it's on the
+// pixel to travel to already, or homes it before travelling once it made
+// REHOME_MOVES moves, or changes pens. Returns false when the plan is done.
+static bool NextMove(uint8_t* hat) {
+	int8_t dx, dy;
+
+	if (ChangePen(hat))
+		return true;
+	while (!travelling && run == 0)
+	{
+		uint8_t head = pgm_read_byte(plan);
+
+		if (head & 0x80)
+		{
+			run_hat = (head >> 3) & 0x07;
+			run = ((head & 0x07) << 8) | pgm_read_byte(plan + 1);
+			plan += 2;
+		}
+		else if (head & 0x40)
+		{
+			// The cursor can travel here from anywhere: go on from here next time
+			JournalWrite(PRINT_ID, plan - PrintPlan);
+			target_x = ((head & 0x01) << 8) | pgm_read_byte(plan + 1);
+			target_y = pgm_read_byte(plan + 2);
+			travelling = true;
+			plan += 3;
+			#if REHOME_ROWS
+			if (moves >= REHOME_MOVES)
+			{
+				moves = 0;
+				xpos = 0;
+				ypos = 0;
+				returning = true;
+				*hat = HAT_HOME;
+				return true;
+			}
+			#endif
+		}
+		else if (head & 0x20)
+		{
+			SetTool(head & 0x1F);
+			plan++;
+			if (ChangePen(hat))
+				return true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	if (travelling)
+	{
+		// Diagonally while both axes are off, then straight
+		dx = (target_x > xpos) - (target_x < xpos);
+		dy = (target_y > ypos) - (target_y < ypos);
+		*hat = pgm_read_byte(&Hats[dy + 1][dx + 1]);
+		if (xpos + dx == target_x && ypos + dy == target_y)
+		{
+			travelling = false;
+			ink_here = true;
+			if (returning)
+			{
+				returning = false;
+				SetMark(MARK_RETURN);
+			}
+		}
+	}
+	else
+	{
+		*hat = run_hat;
+		dx = pgm_read_byte(&HatX[run_hat]);
+		dy = pgm_read_byte(&HatY[run_hat]);
+		run--;
+		ink_here = true;
+	}
+	xpos += dx;
+	ypos += dy;
+	moves++;
+	return true;
+}
+#else
+// The row of the image being printed, the canvas columns its sweep starts and
+// ends at, whether the cursor got to its start, and the row the cursor was
+// homed at.
+static uint8_t row;
+static uint16_t sweep_start;
+static uint16_t sweep_end;
+static bool sweeping;
+static uint8_t homed_row;
+
+#ifdef IMAGE_RLE
+// Where the next row's runs start, in which half of the byte, and the last
+// row decoded.
+static const uint8_t* runs;
+static bool high_nibble;
+static uint8_t RowBits[IMAGE_STRIDE];
+
+static uint8_t NextNibble(void) {
+	uint8_t nibble = pgm_read_byte(runs);
+
+	if (high_nibble)
+	{
+		nibble >>= 4;
+		runs++;
+	}
+	high_nibble = !high_nibble;
+	return nibble & 0x0F;
+}
+
+static void RowSpan(uint8_t y, uint16_t* first, uint16_t* last);
+
+// Starts decoding at row `from`.
+static void StartImage(uint8_t from) {
+	uint8_t y;
+	uint16_t first, last;
+
+	runs = image_runs;
+	high_nibble = false;
+	for (y = 0; y < from; y++)
+		RowSpan(y, &first, &last);
+}
+
+// Decodes the next row of image_runs into RowBits, and returns the first and
+// last set column of it. Rows are decoded in order from StartImage on, so `y`
+// is only the row expected.
+static void RowSpan(uint8_t y, uint16_t* first, uint16_t* last) {
+	uint16_t x = 0;
+	bool set = false;
+
+	memset(RowBits, 0, sizeof(RowBits));
+	*first = ROW_BLANK;
+	*last = 0;
+	while (x < IMAGE_WIDTH)
+	{
+		uint8_t n = NextNibble();
+
+		if (n == 15)
+		{
+			n = NextNibble();
+			n |= NextNibble() << 4;
+		}
+		if (set && n)
+		{
+			if (*first == ROW_BLANK)
+				*first = x;
+			*last = x + n - 1;
+			// Up to a byte boundary, then whole bytes
+			for (; n && (x & 7); n--, x++)
+				RowBits[x / 8] |= IMAGE_BIT(x);
+			for (; n >= 8; n -= 8, x += 8)
+				RowBits[x / 8] = 0xFF;
+			for (; n; n--, x++)
+				RowBits[x / 8] |= IMAGE_BIT(x);
+		}
+		x += n;
+		set = !set;
+	}
+}
+
+// Whether the pixel at x is set in the row decoded last.
+static bool PixelSet(uint16_t x, uint8_t y) {
+	return RowBits[x / 8] & IMAGE_BIT(x);
+}
+#else
+static void StartImage(uint8_t from) {
+}
+
+static void RowSpan(uint8_t y, uint16_t* first, uint16_t* last) {
+	*first = pgm_read_word(&image_rows[y][0]);
+	*last = pgm_read_word(&image_rows[y][1]);
+}
+
+// Whether the pixel at (x, y) of the image is set.
+static bool PixelSet(uint16_t x, uint8_t y) {
+	return pgm_read_byte(&image_data[(x / 8) + y * IMAGE_STRIDE]) & IMAGE_BIT(x);
+}
+#endif
+
+// Starts the sweep once the cursor is at its start.
+static void CheckSweep(void) {
+	if (ypos == IMAGE_Y + row && xpos == sweep_start)
+	{
+		sweeping = true;
+		if (returning)
+		{
+			returning = false;
+			SetMark(MARK_RETURN);
+		}
+	}
+}
+
+// Picks the first row from `from` on with a set pixel, to sweep from the end
+// nearer the cursor. Returns false if there's none left.
+static bool NextRow(uint8_t from) {
+	for (row = from; row < IMAGE_HEIGHT; row++)
+	{
+		uint16_t first, last;
+
+		RowSpan(row, &first, &last);
+		if (first == ROW_BLANK)
+			continue;
+		first += IMAGE_X;
+		last += IMAGE_X;
+		if (xpos <= first || xpos - first <= last - xpos)
+		{
+			sweep_start = first;
+			sweep_end = last;
+		}
+		else
+		{
+			sweep_start = last;
+			sweep_end = first;
+		}
+		sweeping = false;
+		CheckSweep();
+		return true;
+	}
+	return false;
+}
+
+// What the journal's progress is for: rows of the image.
+#define PRINT_ID IMAGE_ID
+
+// Starts on row `from`.
+static bool StartPrint(uint16_t from) {
+	StartImage(from);
+	if (!NextRow(from))
+		return false;
+	homed_row = row;
+	return true;
+}
+
+static bool InkHere(void) {
+	return sweeping && PixelSet(xpos - IMAGE_X, ypos - IMAGE_Y);
+}
+
+// Moves the cursor one pixel: down to the row, across to the start of its
+// sweep, then along it, or homes it before a row REHOME_ROWS below the last
+// one it was homed at. Returns false when the image is done.
+static bool NextMove(uint8_t* hat) {
+	uint16_t target;
+
+	if (sweeping && xpos == sweep_end)
+	{
+		if (!NextRow(row + 1))
+			return false;
+		// The rows above are done: go on from this one next time
+		JournalWrite(PRINT_ID, row);
+		#if REHOME_ROWS
+		if (row >= homed_row + REHOME_ROWS)
+		{
+			// From the corner, the sweep starts at the left end
+			homed_row = row;
+			xpos = 0;
+			ypos = 0;
+			if (sweep_start > sweep_end)
+			{
+				uint16_t end = sweep_start;
+
+				sweep_start = sweep_end;
+				sweep_end = end;
+			}
+			sweeping = false;
+			returning = true;
+			*hat = HAT_HOME;
+			return true;
+		}
+		#endif
+	}
+	target = sweeping ? sweep_end : sweep_start;
+	if (ypos < IMAGE_Y + row)
+	{
+		ypos++;
+		*hat = HAT_BOTTOM;
+	}
+	else if (xpos < target)
+	{
+		xpos++;
+		*hat = HAT_RIGHT;
+	}
+	else
+	{
+		xpos--;
+		*hat = HAT_LEFT;
+	}
+	CheckSweep();
+	return true;
+}
+#endif
+
+// Native printing the image, one press or release per call, from the top-left
+// corner of the canvas.
+uint16_t PrintImage(USB_JoystickReport_Input_t* const ReportData, bool starting) {
+	uint8_t hat;
+	uint16_t from;
+
+	JournalTask();
+	if (starting)
+		stage = START;
+	for (;;)
+	{
+		switch (stage)
+		{
+			case START:
+				xpos = 0;
+				ypos = 0;
+				#ifdef PRINT_FRESH
+				from = 0;
+				#else
+				from = JournalRead(PRINT_ID);
+				#endif
+				if (!StartPrint(from))
+					break;
+				#ifndef PLAN_DELTA
+				if (from == 0)
+				{
+					// A new print: clear the canvas first
+					ReportData->Button |= SWITCH_LCLICK;
+					stage = CLEAR;
+					return BUTTON_DURATION;
+				}
+				#endif
+				/* fall through */
+			case INK:
+				if (InkHere())
+				{
+					ReportData->Button |= ink_button;
+					stage = INK_RELEASE;
+					return PRINT_TICKS;
+				}
+				// Nothing to ink: move on right away
+				/* fall through */
+			case MOVE:
+				if (!NextMove(&hat))
+					break;
+				if (hat == HAT_CENTER)
+				{
+					// On the next pixel already
+					stage = INK;
+					continue;
+				}
+				if (hat == HAT_PEN)
+				{
+					ReportData->Button |= pen_button;
+					stage = MOVE_RELEASE;
+					return BUTTON_DURATION;
+				}
+				if (hat == HAT_HOME)
+				{
+					ReportData->LX = STICK_MIN;
+					ReportData->LY = STICK_MIN;
+					SetMark(MARK_REHOME);
+					stage = MOVE_RELEASE;
+					return HOME_TICKS;
+				}
+				ReportData->HAT = hat;
+				stage = MOVE_RELEASE;
+				return PRINT_TICKS;
+			case CLEAR:
+				stage = INK;
+				return CLEAR_TICKS;
+			case INK_RELEASE:
+				stage = MOVE;
+				return PRINT_TICKS;
+			case MOVE_RELEASE:
+				stage = INK;
+				return PRINT_TICKS;
+			case DONE:
+				break;
+		}
+		break;
+	}
+
+	// The next print starts over
+	JournalWrite(PRINT_ID, 0);
+	JournalFlush();
+	#ifdef ALERT_WHEN_DONE
+	// Flash the LEDs and sound the buzzer from now on
+	stage = DONE;
+	portsval = ~portsval;
+	PORTD = portsval; //flash LED(s) and sound buzzer if attached
+	PORTB = portsval;
+	return 250 / ENGINE_TICK_MS;
+	#else
+	// Done: ready to print again
+	stage = START;
+	return NATIVE_DONE;
+	#endif
+}
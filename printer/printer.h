@@ -0,0 +1,97 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2014.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2014  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Header file for printer.c.
+ */
+
+#ifndef _PRINTER_H_
+#define _PRINTER_H_
+
+/* Includes: */
+#include "../Engine.h"
+#include "../image.h"
+
+/* Macros: */
+// The post canvas, in pixels.
+#define CANVAS_WIDTH  320
+#define CANVAS_HEIGHT 120
+
+// How long each press and each release lasts while printing, in engine ticks.
+#ifndef PRINT_TICKS
+#define PRINT_TICKS 1
+#endif
+
+// How long the canvas takes to clear, in engine ticks.
+#define CLEAR_TICKS 50
+
+// How long the stick is held up-left to home the cursor, in engine ticks:
+// long enough from anywhere on the canvas. The same as HOME in printer.mac.
+#define HOME_TICKS 300
+
+// Homes the cursor again every this many rows, or the moves of as many rows
+// across the canvas when following a plan, so that a report the console
+// missed only shifts the pixels up to the next time. 0 never does.
+#ifndef REHOME_ROWS
+#define REHOME_ROWS 0
+#endif
+#define REHOME_MOVES ((uint32_t)REHOME_ROWS * CANVAS_WIDTH)
+
+// Marks for the traces of the host build: homing the cursor again, and
+// printing again once it's back where it was.
+#define MARK_REHOME 2
+#define MARK_RETURN 3
+
+// A blank row in image_rows.
+#define ROW_BLANK 0xFFFF
+
+// The bit of image_data holding pixel x of its row.
+#if IMAGE_LSB_FIRST
+#define IMAGE_BIT(x) (1 << ((x) & 7))
+#else
+#define IMAGE_BIT(x) (0x80 >> ((x) & 7))
+#endif
+
+// Records of a print plan, generated by ../plan.py: travel to (x, y) and ink
+// there, ink `count` more pixels in a D-pad direction, ink with another tool
+// from then on, and the end.
+#define PLAN_TRAVEL(x, y)    (0x40 | ((x) >> 8)), ((x) & 0xFF), (y)
+#define PLAN_INK(hat, count) (0x80 | ((hat) << 3) | ((count) >> 8)), ((count) & 0xFF)
+#define PLAN_TOOL(tool)      (0x20 | (tool))
+#define PLAN_END             0x00
+
+// Tools: the pen, with A, or the eraser, with B, and the size of either,
+// from the smallest, 0, up: L and R go one size down and up.
+#define TOOL_PEN     0
+#define TOOL_ERASER  1
+#define TOOL_SIZE(n) ((n) << 1)
+
+#endif
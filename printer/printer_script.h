@@ -0,0 +1,34 @@
+/*
+  Generated by mac2c.py from printer.mac. Do not edit; edit the .mac file and
+  run "python mac2c.py printer.mac" again.
+*/
+
+enum {
+  MAIN,
+  SYNC,
+};
+
+enum {
+  NATIVE_PRINT,
+};
+
+uint16_t PrintImage(USB_JoystickReport_Input_t* const ReportData, bool starting);
+
+// 11 bytes
+const Step_t Main[] PROGMEM = {
+  CALL(SYNC),
+  MOVE(POS_UP_LEFT, 300),
+  MARK(1),
+  NATIVE(NATIVE_PRINT),
+  MARK(4),
+  END,
+};
+
+const Step_t* const Routines[] PROGMEM = {
+  [MAIN] = Main,
+  [SYNC] = SyncController,
+};
+
+const Native_t Natives[] PROGMEM = {
+  [NATIVE_PRINT] = PrintImage,
+};
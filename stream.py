@@ -0,0 +1,192 @@
+#!/bin/python
+
+# Streams reports to the streaming firmware (stream/, see stream.c) over a
+# serial port, or writes the stream to a file for the host build's -u.
+#
+#   stream.py [-o file] [-d device] [-b baud] [-k frames] [-l] trace
+#
+# The reports come from a trace of the host build (host/build/<script>), each
+# held until the next one, so that any script or print can be played without
+# flashing it:
+#
+#   $ host/build/printer -t 2000000 -m 4 > print.trace
+#   $ python stream.py -d /dev/ttyUSB0 print.trace
+#
+# Each report becomes a frame holding the fields that changed from the one
+# before and its duration in ms, up to 32767, a longer one taking several
+# frames (see stream/stream.h). Every -k frames (50 by default), a frame
+# holds every field, so that the report comes right again after a frame was
+# lost. A frame with no report ends the stream. With -d, the port is
+# set to -b baud (115200, STREAM_BAUD's default), 8N1, and the stream starts
+# on the firmware's XON, which it sends every second between streams, or
+# after XON_WAIT seconds without one; from then on the kernel stops sending
+# on XOFF and goes on at XON.
+#
+# -l is for the firmware's live mode (make with-live, in stream/): each
+# frame is sent when its report starts rather than ahead of time, and the
+# latency stats the firmware sends back are printed. With -o, the file is
+# then made of timed chunks for the host build's -U.
+
+import sys, os, getopt, select, struct, time
+
+XON = 0x11
+XON_WAIT = 3.0
+STREAM_SYNC, FRAME_END = 0xA5, 0x80
+MAX_MS = 0x7fff
+NEUTRAL = [0, 0, 8, 128, 128, 128, 128]
+
+class StreamError(Exception):
+  pass
+
+# The reports of a trace, as (report bytes, ms) for as long as each lasts.
+def reports(lines):
+  starts = []
+  for line in lines:
+    f = line.split()
+    if len(f) == 2 and f[1] == 'end':
+      ends = [ms for _, ms in starts[1:]] + [int(f[0])]
+      return [(report, end - ms) for (report, ms), end in zip(starts, ends) if end > ms]
+    if len(f) == 7 and f[0] != '#':
+      button, hat = int(f[1], 16), int(f[2], 16)
+      starts.append(([button & 0xff, button >> 8, hat] + [int(v) for v in f[3:]], int(f[0])))
+  raise StreamError('the trace has no end line: was it cut short?')
+
+# CRC-8 with the polynomial x^8 + x^2 + x + 1, as avr-libc's
+# _crc8_ccitt_update.
+def crc8(data, crc=0):
+  for b in data:
+    crc ^= b
+    for _ in range(8):
+      crc = ((crc << 1) ^ 0x07 if crc & 0x80 else crc << 1) & 0xff
+  return crc
+
+def frame(body):
+  return bytearray([STREAM_SYNC] + body + [crc8(body)])
+
+# The frames for a trace's reports, from a neutral report, and ended, each
+# with the time it starts at, in ms.
+def frames(held, keyframe):
+  out = []
+  last, at = NEUTRAL, 0
+  for report, ms in held:
+    while ms > 0:
+      d = min(ms, MAX_MS)
+      changed = [i for i in range(len(report)) if report[i] != last[i] or len(out) % keyframe == 0]
+      body = [sum(1 << i for i in changed)] + [report[i] for i in changed]
+      body += [d] if d < 0x80 else [0x80 | d >> 8, d & 0xff]
+      out.append((at, frame(body)))
+      last, ms, at = report, ms - d, at + d
+  return out + [(at, frame([FRAME_END]))]
+
+# The frames as the host build's -U reads them: each the time to send it at,
+# its length and its bytes.
+def timed(out):
+  data = bytearray()
+  for at, f in out:
+    data += bytearray(struct.pack('<IB', at, len(f))) + f
+  return data
+
+# Opens a serial port and waits for the firmware's XON, for XON_WAIT seconds
+# at most.
+def open_port(device, baud):
+  import termios, tty
+  fd = os.open(device, os.O_RDWR | os.O_NOCTTY)
+  tty.setraw(fd)
+  attrs = termios.tcgetattr(fd)
+  speed = getattr(termios, 'B%d' % baud, None)
+  if speed is None:
+    raise StreamError('%d baud is not a speed the port knows' % baud)
+  attrs[4] = attrs[5] = speed
+  termios.tcsetattr(fd, termios.TCSANOW, attrs)
+  termios.tcflush(fd, termios.TCIOFLUSH)
+  until = time.time() + XON_WAIT
+  while select.select([fd], [], [], max(until - time.time(), 0))[0]:
+    if XON in bytearray(os.read(fd, 64)):
+      break
+  return fd
+
+# Sends the stream, letting the kernel mind XON and XOFF.
+def send(fd, data):
+  import termios
+  attrs = termios.tcgetattr(fd)
+  attrs[0] |= termios.IXON
+  termios.tcsetattr(fd, termios.TCSANOW, attrs)
+  at = 0
+  while at < len(data):
+    at += os.write(fd, bytes(data[at:at + 256]))
+  termios.tcdrain(fd)
+
+# The text the firmware sent, without its XONs.
+def text_read(fd):
+  return bytearray(os.read(fd, 256)).replace(bytearray([XON]), b'')
+
+# Sends each frame when it starts, printing the lines the firmware sends
+# back, until the stats that follow the end.
+def send_live(fd, out):
+  start, text = time.time(), bytearray()
+  for at, f in out:
+    while True:
+      wait = start + at / 1000.0 - time.time()
+      if select.select([fd], [], [], max(wait, 0))[0]:
+        text += text_read(fd)
+        while b'\n' in text:
+          line, text = text.split(b'\n', 1)
+          print(line.decode().strip())
+      elif wait <= 0:
+        break
+    os.write(fd, bytes(f))
+  while select.select([fd], [], [], 1.0)[0]:
+    text += text_read(fd)
+    if b'\n' in text:
+      print(text.split(b'\n')[-2].decode().strip())
+      break
+
+def main(argv):
+  opts, args = getopt.getopt(argv, "ho:d:b:k:l")
+  output, device, baud, keyframe, live = None, None, 115200, 50, False
+  for opt, arg in opts:
+    if opt == '-h':
+      usage()
+      sys.exit()
+    elif opt == '-o':
+      output = arg
+    elif opt == '-d':
+      device = arg
+    elif opt == '-b':
+      baud = int(arg)
+    elif opt == '-k':
+      keyframe = int(arg)
+    elif opt == '-l':
+      live = True
+  if len(args) != 1 or not (output or device):
+    usage()
+    sys.exit(1)
+
+  held = reports(open(args[0]))
+  out = frames(held, keyframe)
+  data = bytearray().join(f for _, f in out)
+  if output:
+    with open(output, 'wb') as f:
+      f.write(timed(out) if live else data)
+  if device:
+    fd = open_port(device, baud)
+    try:
+      if live:
+        send_live(fd, out)
+      else:
+        send(fd, data)
+    finally:
+      os.close(fd)
+  ms = sum(ms for _, ms in held)
+  print("{} streamed: {} reports, {} bytes over {:.1f} s, {:.1f}% of a report every ms".format(
+    args[0], len(held), len(data), ms / 1000.0, 100.0 * len(data) / (ms * 8)))
+
+def usage():
+  print("To stream a trace to the board: stream.py -d /dev/ttyUSB0 yourScript.trace")
+  print("To write it for the host build's -u: stream.py -o yourScript.stream yourScript.trace")
+  print("At another baud rate: stream.py -b 250000 -d /dev/ttyUSB0 yourScript.trace")
+  print("Live, as it goes: stream.py -l -d /dev/ttyUSB0 yourScript.trace")
+  print("Live, for the host build's -U: stream.py -l -o yourScript.live yourScript.trace")
+
+if __name__ == "__main__":
+  main(sys.argv[1:])
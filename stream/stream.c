@@ -0,0 +1,529 @@
+/*
+Nintendo Switch Fightstick - Proof-of-Concept
+
+Based on the LUFA library's Low-Level Joystick Demo
+	(C) Dean Camera
+Based on the HORI's Pokken Tournament Pro Pad design
+	(C) HORI
+
+This project implements a modified version of HORI's Pokken Tournament Pro Pad
+USB descriptors to allow for the creation of custom controllers for the
+Nintendo Switch. This also works to a limited degree on the PS3.
+
+Since System Update v3.0.0, the Nintendo Switch recognizes the Pokken
+Tournament Pro Pad as a Pro Controller. Physical design limitations prevent
+the Pokken Controller from functioning at the same level as the Pro
+Controller. However, by default most of the descriptors are there, with the
+exception of Home and Capture. Descriptor modification allows us to unlock
+these buttons for our use.
+*/
+
+/** \file
+ *
+ *  Main source file for streaming playback: rather than a program in flash,
+ *  the controller plays reports a PC streams to the AVR's hardware UART
+ *  (USART1), so that a script changes without reflashing the board and is
+ *  only limited by what the PC can compute. ../stream.py turns a trace of
+ *  the host build into such a stream and sends it.
+ *
+ *  The stream is made of frames (see stream.h), each a report held for so
+ *  many milliseconds, carrying only the fields that changed from the report
+ *  before: a D-pad press and its release take 5 bytes each, where a report
+ *  every millisecond would take 8000 bytes a second, more than 115200 baud
+ *  carries. A frame that fails its check is dropped, and the stream picks up
+ *  again from the next one; the PC sends every field now and then, so that
+ *  the report comes right again.
+ *
+ *  The receive interrupt puts each byte into a ring that StreamReports, a
+ *  native, takes frames from as the engine asks for reports. Only the
+ *  interrupt moves the head and only the native moves the tail, each a
+ *  single byte, so neither needs a lock. The ring never runs dry as long as
+ *  the PC keeps up: XOFF asks it to stop before the ring fills, XON to go on
+ *  once it's down to a quarter, both sent from the transmit interrupt. XON is
+ *  also sent at power-up, and every STREAM_XON_MS while no stream comes in,
+ *  for the PC to start on.
+ *
+ *  While there's no stream, the controller stays neutral. If the reports run
+ *  out in the middle of one, it's neutral until they come back.
+ *
+ *  Built with STREAM_LIVE, for driving the console from a gamepad or a tool
+ *  on the PC, nothing is queued: the receive interrupt decodes each frame as
+ *  it comes in, and LiveReport, called by the engine as each report goes out
+ *  (REPORT_HOOK), sends the latest report, ignoring durations. Each frame is
+ *  timestamped as its last byte comes in, and the time until the first
+ *  report carrying it goes out is counted in a histogram, whose percentiles
+ *  go back to the PC as a line of text every LIVE_STATS_MS and at the end of
+ *  each stream.
+ */
+
+#include <util/crc16.h>
+
+#include "stream.h"
+
+#include "stream_script.h"
+
+// Sets the report to neutral.
+static void Neutral(USB_JoystickReport_Input_t* const r) {
+	memset(r, 0, sizeof(USB_JoystickReport_Input_t));
+	r->HAT = HAT_CENTER;
+	r->LX = STICK_CENTER;
+	r->LY = STICK_CENTER;
+	r->RX = STICK_CENTER;
+	r->RY = STICK_CENTER;
+}
+
+// The number of fields a frame's flags say it carries.
+static uint8_t FieldCount(uint8_t flags) {
+	uint8_t count = 0, i;
+
+	for (i = 0; i < FRAME_FIELDS; i++)
+		if (flags & (1 << i))
+			count++;
+	return count;
+}
+
+// Whether the PC should be stopped, and whether it's been told so, by the
+// transmit interrupt; it starts off told to stop, so that XON goes out first.
+static volatile bool paused = false;
+static bool told_paused = true;
+// XON is wanted again, for a PC waiting to start, and when it last went out,
+// in Milliseconds.
+static volatile bool nudge = false;
+static uint32_t nudged_at = 0;
+
+// The report the frames change, from neutral at the start of each stream.
+static USB_JoystickReport_Input_t report;
+
+// Whether the UART is set up.
+static bool ready = false;
+
+// Double speed, 8N1, both interrupts on; the transmit one says XON.
+static void StreamInit(void) {
+	UBRR1 = (F_CPU + 4UL * STREAM_BAUD) / (8UL * STREAM_BAUD) - 1;
+	UCSR1A = (1 << U2X1);
+	UCSR1C = (1 << UCSZ11) | (1 << UCSZ10);
+	UCSR1B = (1 << RXCIE1) | (1 << UDRIE1) | (1 << RXEN1) | (1 << TXEN1);
+	nudged_at = Millis();
+	ready = true;
+}
+
+// Sends XON again if it's STREAM_XON_MS since it last went out, the line
+// being idle.
+static void Nudge(void) {
+	uint32_t now = Millis();
+
+	if ((int32_t)(now - nudged_at) < STREAM_XON_MS)
+		return;
+	nudged_at = now;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		nudge = true;
+		UCSR1B |= (1 << UDRIE1);
+	}
+}
+
+#ifdef STREAM_LIVE
+#define TX_MASK (LIVE_TX_BUFFER - 1)
+
+// Text for the PC, from tx_tail, moved by the transmit interrupt only, up to
+// tx_head.
+static volatile uint8_t TxRing[LIVE_TX_BUFFER];
+static volatile uint8_t tx_head = 0;
+static volatile uint8_t tx_tail = 0;
+#endif
+
+// Tells the PC to stop or go on whenever that changed, sends the text
+// queued, then goes quiet.
+ISR(USART1_UDRE_vect) {
+	if (told_paused != paused)
+	{
+		told_paused = paused;
+		UDR1 = paused ? XOFF : XON;
+	}
+	else if (nudge && !paused)
+	{
+		nudge = false;
+		UDR1 = XON;
+	}
+	#ifdef STREAM_LIVE
+	else if (tx_tail != tx_head)
+	{
+		UDR1 = TxRing[tx_tail];
+		tx_tail = (tx_tail + 1) & TX_MASK;
+	}
+	#endif
+	else
+	{
+		UCSR1B &= ~(1 << UDRIE1);
+	}
+}
+
+#ifndef STREAM_LIVE
+#define RING_MASK (STREAM_BUFFER - 1)
+
+// The ring: bytes from tail up to head, which are written by the receive
+// interrupt only, and tail by StreamReports only.
+static volatile uint8_t Ring[STREAM_BUFFER];
+static volatile uint8_t head = 0;
+static volatile uint8_t tail = 0;
+
+// A byte was lost, the ring being full, for StreamReports to mark.
+static volatile bool overrun = false;
+
+// Whether a stream is playing, and it ran dry.
+static bool streaming = false;
+static bool starved = false;
+
+static uint8_t Fill(void) {
+	return (head - tail) & RING_MASK;
+}
+
+// The byte `at` bytes past the tail.
+static uint8_t Peek(uint8_t at) {
+	return Ring[(tail + at) & RING_MASK];
+}
+
+// Drops `length` bytes, and has the PC go on if that made room.
+static void Drop(uint8_t length) {
+	tail = (tail + length) & RING_MASK;
+	if (paused && Fill() <= STREAM_LOW)
+	{
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+			paused = false;
+			UCSR1B |= (1 << UDRIE1);
+		}
+	}
+}
+
+// The length of the frame at the tail, which starts with STREAM_SYNC, or 0
+// if it isn't all in yet.
+static uint8_t FrameLength(void) {
+	uint8_t fill = Fill();
+	uint8_t flags, length;
+
+	if (fill < 2)
+		return 0;
+	flags = Peek(1);
+	if (flags & FRAME_END)
+		return fill >= 3 ? 3 : 0;
+	length = 2 + FieldCount(flags);
+	if (fill <= length)
+		return 0;
+	length += (Peek(length) & 0x80) ? 3 : 2;
+	return fill >= length ? length : 0;
+}
+
+ISR(USART1_RX_vect) {
+	uint8_t c = UDR1;
+	uint8_t next = (head + 1) & RING_MASK;
+
+	if (next == tail)
+	{
+		overrun = true;
+		return;
+	}
+	Ring[head] = c;
+	head = next;
+	if (!paused && Fill() >= STREAM_BUFFER - STREAM_HEADROOM)
+	{
+		paused = true;
+		UCSR1B |= (1 << UDRIE1);
+	}
+}
+
+uint16_t StreamReports(USB_JoystickReport_Input_t* const ReportData, bool starting) {
+	uint8_t length, flags, crc, at, i;
+	uint16_t ms;
+
+	if (!ready)
+		StreamInit();
+	if (starting)
+	{
+		streaming = false;
+		Neutral(&report);
+	}
+	if (overrun)
+	{
+		overrun = false;
+		SetMark(MARK_OVERRUN);
+	}
+
+	for (;;)
+	{
+		// Skip to the next frame
+		while (Fill() && Peek(0) != STREAM_SYNC)
+		{
+			Drop(1);
+			SetMark(MARK_CORRUPT);
+		}
+		length = FrameLength();
+		if (!length)
+		{
+			// Nothing to play: stay neutral for a tick, and between streams,
+			// remind the PC that it may start
+			if (streaming && !starved)
+			{
+				starved = true;
+				SetMark(MARK_UNDERRUN);
+			}
+			if (!streaming && !Fill())
+				Nudge();
+			return 1;
+		}
+		crc = 0;
+		for (at = 1; at < length - 1; at++)
+			crc = _crc8_ccitt_update(crc, Peek(at));
+		if (crc == Peek(length - 1))
+			break;
+		// Not a frame after all
+		Drop(1);
+		SetMark(MARK_CORRUPT);
+	}
+
+	starved = false;
+	flags = Peek(1);
+	if (flags & FRAME_END)
+	{
+		Drop(length);
+		streaming = false;
+		return NATIVE_DONE;
+	}
+	// The fields are the report's first bytes, in order
+	at = 2;
+	for (i = 0; i < FRAME_FIELDS; i++)
+		if (flags & (1 << i))
+			((uint8_t*)&report)[i] = Peek(at++);
+	ms = Peek(at);
+	if (ms & 0x80)
+		ms = ((ms & 0x7F) << 8) | Peek(at + 1);
+	Drop(length);
+
+	streaming = true;
+	memcpy(ReportData, &report, sizeof(USB_JoystickReport_Input_t));
+	return ms;
+}
+
+#else
+#define FRAME_MAX (2 + FRAME_FIELDS + 3)
+
+// The frame coming in, and its length so far and in all, once known.
+static uint8_t frame[FRAME_MAX];
+static uint8_t got = 0;
+static uint8_t want = 0;
+
+// When the frame that last changed the report came in, in us, and whether a
+// report has gone out with it yet.
+static volatile uint32_t received_at;
+static volatile bool fresh = false;
+// Whether a stream is coming in: from its first frame to its end.
+static volatile bool streaming = false;
+
+// Counts since the last stats: frames taken, frames another one replaced
+// before a report went out with them, and bytes that weren't a frame or
+// frames that failed their check.
+static volatile uint16_t frames = 0;
+static volatile uint16_t skipped = 0;
+static volatile uint16_t bad = 0;
+// The latencies of the others, and the longest, in us.
+static uint16_t latencies[LIVE_BUCKETS];
+static uint16_t samples = 0;
+static uint32_t longest = 0;
+
+// Stats are wanted now, at the end of a stream, or once it's LIVE_STATS_MS
+// since the last ones.
+static volatile bool stats_due = false;
+static uint32_t stats_at = 0;
+static uint16_t bad_marked = 0;
+
+// Microseconds since power-up, to Timer 0's resolution: it counts them
+// between its compare matches, which count the milliseconds. Interrupts
+// must be off.
+static uint32_t Micros(void) {
+	uint8_t count = TCNT0;
+	uint32_t ms = Milliseconds;
+
+	// A compare match came after the count wrapped, but wasn't counted yet
+	if ((TIFR0 & (1 << OCF0A)) && count < OCR0A / 2)
+		ms++;
+	return ms * 1000 + (uint32_t)count * 64 / (F_CPU / 1000000);
+}
+
+ISR(USART1_RX_vect) {
+	uint8_t c = UDR1;
+	uint8_t crc, at, i;
+
+	if (got == 0 && c != STREAM_SYNC)
+	{
+		bad++;
+		return;
+	}
+	frame[got++] = c;
+	if (got == 1)
+		want = 2;
+	else if (got == 2)
+		want = (c & FRAME_END) ? 3 : 2 + FieldCount(c) + 2;
+	else if (!(frame[1] & FRAME_END) && got == 3 + FieldCount(frame[1]) && (c & 0x80))
+		want++;
+	if (got < want)
+		return;
+
+	got = 0;
+	crc = 0;
+	for (at = 1; at < want; at++)
+		crc = _crc8_ccitt_update(crc, frame[at]);
+	if (crc != 0)
+	{
+		bad++;
+		return;
+	}
+	if (frame[1] & FRAME_END)
+	{
+		// Let go of everything, and tell how it went
+		Neutral(&report);
+		streaming = false;
+		stats_due = true;
+		return;
+	}
+	at = 2;
+	for (i = 0; i < FRAME_FIELDS; i++)
+		if (frame[1] & (1 << i))
+			((uint8_t*)&report)[i] = frame[at++];
+	received_at = Micros();
+	streaming = true;
+	frames++;
+	if (fresh)
+		skipped++;
+	fresh = true;
+}
+
+void LiveReport(USB_JoystickReport_Input_t* const ReportData) {
+	uint32_t latency = 0;
+	bool sample;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		memcpy(ReportData, &report, sizeof(USB_JoystickReport_Input_t));
+		sample = fresh;
+		if (sample)
+			latency = Micros() - received_at;
+		fresh = false;
+	}
+	if (!sample)
+		return;
+	if (latency > longest)
+		longest = latency;
+	latency /= LIVE_BUCKET_US;
+	latencies[latency < LIVE_BUCKETS ? latency : LIVE_BUCKETS - 1]++;
+	samples++;
+}
+
+// Queues text for the PC, dropping what doesn't fit.
+static void Send(char c) {
+	uint8_t next = (tx_head + 1) & TX_MASK;
+
+	if (next == tx_tail)
+		return;
+	TxRing[tx_head] = c;
+	tx_head = next;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		UCSR1B |= (1 << UDRIE1);
+	}
+}
+
+static void SendText(const char* text) {
+	char c;
+
+	while ((c = pgm_read_byte(text++)))
+		Send(c);
+}
+
+static void SendNumber(uint32_t n) {
+	char digits[10];
+	uint8_t i = 0;
+
+	do
+	{
+		digits[i++] = '0' + n % 10;
+		n /= 10;
+	} while (n);
+	while (i)
+		Send(digits[--i]);
+}
+
+// The latency under which `percent` of the samples came, to a bucket, or
+// the longest if that's shorter.
+static uint32_t Percentile(uint8_t percent) {
+	uint32_t wanted = ((uint32_t)samples * percent + 99) / 100;
+	uint32_t seen = 0;
+	uint8_t i;
+
+	for (i = 0; i < LIVE_BUCKETS - 1; i++)
+	{
+		seen += latencies[i];
+		if (seen >= wanted && (uint32_t)(i + 1) * LIVE_BUCKET_US < longest)
+			return (uint32_t)(i + 1) * LIVE_BUCKET_US;
+		if (seen >= wanted)
+			break;
+	}
+	return longest;
+}
+
+// Sends the stats, such as "live 1200 frames 3 skipped 0 bad, latency us p50
+// 4000 p90 7250 p99 8000 max 7996", and starts them over.
+static void SendStats(void) {
+	uint16_t taken, replaced, dropped;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		taken = frames;
+		replaced = skipped;
+		dropped = bad;
+		frames = skipped = bad = 0;
+	}
+	bad_marked = 0;
+	SendText(PSTR("live "));
+	SendNumber(taken);
+	SendText(PSTR(" frames "));
+	SendNumber(replaced);
+	SendText(PSTR(" skipped "));
+	SendNumber(dropped);
+	SendText(PSTR(" bad, latency us p50 "));
+	SendNumber(Percentile(50));
+	SendText(PSTR(" p90 "));
+	SendNumber(Percentile(90));
+	SendText(PSTR(" p99 "));
+	SendNumber(Percentile(99));
+	SendText(PSTR(" max "));
+	SendNumber(longest);
+	SendText(PSTR("\r\n"));
+	memset(latencies, 0, sizeof(latencies));
+	samples = 0;
+	longest = 0;
+}
+
+// LiveReport makes the reports; this sends the stats when they're due.
+uint16_t StreamReports(USB_JoystickReport_Input_t* const ReportData, bool starting) {
+	uint32_t now = Millis();
+
+	if (!ready)
+	{
+		Neutral(&report);
+		stats_at = now;
+		StreamInit();
+	}
+	if (bad != bad_marked)
+	{
+		bad_marked = bad;
+		SetMark(MARK_CORRUPT);
+	}
+	if (stats_due || (frames && (int32_t)(now - stats_at) >= LIVE_STATS_MS))
+	{
+		stats_due = false;
+		stats_at = now;
+		SendStats();
+	}
+	// Between streams, remind the PC that it may start, after the stats
+	if (streaming)
+		nudged_at = now;
+	else
+		Nudge();
+	return 1;
+}
+#endif
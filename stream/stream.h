@@ -0,0 +1,106 @@
+/*
+             LUFA Library
+     Copyright (C) Dean Camera, 2014.
+
+  dean [at] fourwalledcubicle [dot] com
+           www.lufa-lib.org
+*/
+
+/*
+  Copyright 2014  Dean Camera (dean [at] fourwalledcubicle [dot] com)
+
+  Permission to use, copy, modify, distribute, and sell this
+  software and its documentation for any purpose is hereby granted
+  without fee, provided that the above copyright notice appear in
+  all copies and that both that the copyright notice and this
+  permission notice and warranty disclaimer appear in supporting
+  documentation, and that the name of the author not be used in
+  advertising or publicity pertaining to distribution of the
+  software without specific, written prior permission.
+
+  The author disclaims all warranties with regard to this
+  software, including all implied warranties of merchantability
+  and fitness.  In no event shall the author be liable for any
+  special, indirect or consequential damages or any damages
+  whatsoever resulting from loss of use, data or profits, whether
+  in an action of contract, negligence or other tortious action,
+  arising out of or in connection with the use or performance of
+  this software.
+*/
+
+/** \file
+ *
+ *  Header file for stream.c.
+ */
+
+#ifndef _STREAM_H_
+#define _STREAM_H_
+
+/* Includes: */
+#include "../Engine.h"
+
+/* Macros: */
+// The UART's speed, in bits per second. It runs at double speed, so that
+// 115200 is only 2% off at 16 MHz.
+#ifndef STREAM_BAUD
+#define STREAM_BAUD 115200
+#endif
+
+// Bytes the ring holds, a power of 2 up to 256; one is always left free.
+#ifndef STREAM_BUFFER
+#define STREAM_BUFFER 256
+#endif
+
+// Flow control: XOFF is sent once no more than STREAM_HEADROOM bytes are
+// free, leaving room for what the PC and its serial adapter send before they
+// stop, and XON once the ring is down to STREAM_LOW bytes, still enough for
+// a good many reports.
+#ifndef STREAM_HEADROOM
+#define STREAM_HEADROOM 64
+#endif
+#define STREAM_LOW (STREAM_BUFFER / 4)
+// While no stream comes in, XON is sent again every STREAM_XON_MS, for a PC
+// that opened its port after the last one, or starts another stream.
+#ifndef STREAM_XON_MS
+#define STREAM_XON_MS 1000
+#endif
+#define XON  0x11
+#define XOFF 0x13
+
+// Frames: STREAM_SYNC, a byte with a bit for each field of the report that
+// changed, bit 0 for the first, those fields' new values, how long the
+// report is held, in ms, and a
+// CRC-8 (_crc8_ccitt_update, from 0) of all but STREAM_SYNC. The fields are
+// Button's low byte, its high byte, HAT, LX, LY, RX and RY, in that order. A
+// duration under 128 ms takes a byte, a longer one two: its high 7 bits with
+// the top bit set, then its low byte. FRAME_END, alone, ends the stream.
+#define STREAM_SYNC  0xA5
+#define FRAME_FIELDS 7
+#define FRAME_END    0x80
+
+// Reports are timed to the millisecond.
+#if ENGINE_TICK_MS != 1
+#error "stream.c times reports in milliseconds: build it with ENGINE_TICK_MS=1"
+#endif
+
+// Live mode (STREAM_LIVE): latencies are counted in LIVE_BUCKETS buckets of
+// LIVE_BUCKET_US, the last holding all the longer ones, and sent to the PC
+// every LIVE_STATS_MS, through a ring of LIVE_TX_BUFFER bytes, a power of 2.
+#define LIVE_BUCKET_US 250
+#define LIVE_BUCKETS   64
+#ifndef LIVE_STATS_MS
+#define LIVE_STATS_MS  10000
+#endif
+#define LIVE_TX_BUFFER 128
+
+// Called with each report about to go out in live mode, see REPORT_HOOK.
+void LiveReport(USB_JoystickReport_Input_t* const ReportData);
+
+// Marks for the traces of the host build: reports ran out while streaming,
+// bytes were lost because the ring was full, and bytes were dropped because
+// they weren't a frame.
+#define MARK_UNDERRUN 2
+#define MARK_OVERRUN  3
+#define MARK_CORRUPT  4
+
+#endif
@@ -0,0 +1,31 @@
+/*
+  Generated by mac2c.py from stream.mac. Do not edit; edit the .mac file and
+  run "python mac2c.py stream.mac" again.
+*/
+
+enum {
+  MAIN,
+};
+
+enum {
+  NATIVE_STREAM,
+};
+
+uint16_t StreamReports(USB_JoystickReport_Input_t* const ReportData, bool starting);
+
+// 7 bytes
+const Step_t Main[] PROGMEM = {
+  FOREVER,
+  MARK(1),
+  NATIVE(NATIVE_STREAM),
+  NEXT,
+  END,
+};
+
+const Step_t* const Routines[] PROGMEM = {
+  [MAIN] = Main,
+};
+
+const Native_t Natives[] PROGMEM = {
+  [NATIVE_STREAM] = StreamReports,
+};
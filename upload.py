@@ -0,0 +1,90 @@
+#!/bin/python
+
+# Uploads a script to a firmware built with SCRIPT_UPLOAD (see Upload.c) over
+# its serial port, which then runs it instead of its own until the next
+# upload, so that changing jobs takes seconds rather than a reflash.
+#
+#   upload.py [-d device] [-b baud] [-o file] [-D NAME=value ...] script.mac
+#
+# The script is compiled as mac2c.py compiles it, -D setting its consts, into
+# an image with a CRC. With -d, the port is set to -b baud (115200 by
+# default), 8N1, and the image is sent with the kernel minding the
+# firmware's XOFF and XON, which stop the PC while a page of flash is
+# written. The firmware answers with a line, "OK <bytes> bytes, <n> routines"
+# or "ERR <why>", which is printed; it's "OK" once the script's in flash and
+# running. -o writes the image to a file instead, for the host build's -u.
+
+import sys, os, getopt, select
+import mac2c
+
+# How long the firmware takes to answer, once the whole image is sent.
+ANSWER_S = 2.0
+
+class UploadError(Exception):
+  pass
+
+def send(device, baud, data):
+  import termios, tty
+  fd = os.open(device, os.O_RDWR | os.O_NOCTTY)
+  try:
+    tty.setraw(fd)
+    attrs = termios.tcgetattr(fd)
+    speed = getattr(termios, 'B%d' % baud, None)
+    if speed is None:
+      raise UploadError('%d baud is not a speed the port knows' % baud)
+    attrs[0] |= termios.IXON
+    attrs[4] = attrs[5] = speed
+    termios.tcsetattr(fd, termios.TCSANOW, attrs)
+    termios.tcflush(fd, termios.TCIOFLUSH)
+    at = 0
+    while at < len(data):
+      at += os.write(fd, bytes(data[at:at + 64]))
+    termios.tcdrain(fd)
+    text = bytearray()
+    while b'\n' not in text:
+      if not select.select([fd], [], [], ANSWER_S)[0]:
+        raise UploadError('no answer from %s: is it built with SCRIPT_UPLOAD?' % device)
+      text += bytearray(os.read(fd, 64))
+    return text.split(b'\n')[0].decode().strip()
+  finally:
+    os.close(fd)
+
+def main(argv):
+  opts, args = getopt.getopt(argv, "hd:b:o:D:")
+  device, baud, output = None, 115200, None
+  for opt, arg in opts:
+    if opt == '-h':
+      usage()
+      sys.exit()
+    elif opt == '-d':
+      device = arg
+    elif opt == '-b':
+      baud = int(arg)
+    elif opt == '-o':
+      output = arg
+  if len(args) != 1 or not (device or output):
+    usage()
+    sys.exit(1)
+
+  try:
+    data = mac2c.image(mac2c.link(mac2c.parse(open(args[0]).read(), mac2c.overrides(opts))))
+  except mac2c.CompileError as e:
+    print("{}: {}".format(args[0], e))
+    sys.exit(1)
+  if output:
+    with open(output, 'wb') as f:
+      f.write(data)
+    print("{} compiled to {} ({} bytes)".format(args[0], output, len(data)))
+  if device:
+    answer = send(device, baud, data)
+    print("{}: {}".format(device, answer))
+    if not answer.startswith('OK'):
+      sys.exit(1)
+
+def usage():
+  print("To upload a script: upload.py -d /dev/ttyUSB0 yourScript.mac")
+  print("With a const set otherwise: upload.py -d /dev/ttyUSB0 -D PAGES=4 delete_box/delete_box.mac")
+  print("To write the image for the host build's -u: upload.py -o yourScript.image yourScript.mac")
+
+if __name__ == "__main__":
+  main(sys.argv[1:])
@@ -0,0 +1,17 @@
+/*
+  Generated by mac2c.py from upload.mac. Do not edit; edit the .mac file and
+  run "python mac2c.py upload.mac" again.
+*/
+
+enum {
+  MAIN,
+};
+
+// 1 bytes
+const Step_t Main[] PROGMEM = {
+  END,
+};
+
+const Step_t* const Routines[] PROGMEM = {
+  [MAIN] = Main,
+};